@@ -19,6 +19,7 @@
 #include "src/OStimNetIntegration.h"
 #include "src/KeyboardInputBlocker.h"
 #include "src/Settings.h"
+#include "src/CatalogLoader.h"
 
 using namespace SKSE;
 
@@ -56,6 +57,12 @@ namespace {
         spdlog::set_default_logger(std::move(logger));
     }
 
+    // Scene, action and furniture data are only safe to read once the catalog
+    // has finished loading; until then the exports return their "unknown" value.
+    bool CatalogReady() {
+        return OStimNavigator::SceneDatabase::GetSingleton().IsReady();
+    }
+
     void PrintToConsole(std::string_view message) {
         SKSE::log::info("{}", message);
         if (auto* console = RE::ConsoleLog::GetSingleton()) {
@@ -115,26 +122,9 @@ SKSEPluginLoad(const LoadInterface* skse) {
                             SKSE::PluginDeclaration::GetSingleton()->GetName().data(),
                             SKSE::PluginDeclaration::GetSingleton()->GetVersion());
 
-                        // Load furniture database (must be loaded before scenes for furniture validation)
-                        OStimNavigator::FurnitureDatabase::GetSingleton().LoadFurnitureTypes();
-
-                        // Load action database (must be loaded before scenes)
-                        OStimNavigator::ActionDatabase::GetSingleton().LoadActions();
-
-                        // Load actor properties database
-                        OStimNavigator::ActorPropertiesDatabase::GetSingleton().LoadActorProperties();
-
-                        // Load animation description database
-                        OStimNavigator::OStimNetMetaData::GetSingleton().LoadDescriptions();
-
-                        // Load scene meta database
-                        OStimNavigator::OStimNetMetaData::GetSingleton().LoadSceneMeta();
-
-                        // Load scene database
-                        OStimNavigator::SceneDatabase::GetSingleton().LoadScenes();
-
-                        // Auto-populate positions in scene meta from scene tags (skips scenes that already have positions)
-                        OStimNavigator::OStimNetMetaData::GetSingleton().AutoPopulatePositions();
+                        // Load the databases. With AsyncCatalogLoad the scene catalog builds
+                        // in the background; exports and UI report "loading" until it is ready.
+                        OStimNavigator::CatalogLoader::Start();
 
                         // Initialize PrismaUI (acquire API handle once at data load time)
                         OStimNavigator::PrismaUIManager::GetSingleton().Initialize();
@@ -144,10 +134,6 @@ SKSEPluginLoad(const LoadInterface* skse) {
 
                         // Register UI elements
                         OStimNavigator::UI::Register();
-
-                        if (auto* console = RE::ConsoleLog::GetSingleton()) {
-                            console->Print("OstimNavigator: Ready");
-                        }
                         break;
                     }
 
@@ -182,17 +168,17 @@ SKSEPluginLoad(const LoadInterface* skse) {
 
 extern "C" __declspec(dllexport)
 const char* ONavBuildSceneDescription(const char* sceneId, uint32_t threadID) {
-    if (!sceneId) return "";
+    if (!sceneId || !CatalogReady()) return "";
     auto* scene = OStimNavigator::SceneDatabase::GetSingleton().GetSceneByID(sceneId);
     if (!scene) return "";
     static std::string s_result;
-    s_result = OStimNavigator::BuildSceneDescription(*scene, threadID);
+    s_result = OStimNavigator::BuildSceneDescription(*scene, OStimNavigator::ThreadContext::Capture(threadID));
     return s_result.c_str();
 }
 
 extern "C" __declspec(dllexport)
 const char* ONavGetAnimationDescription(const char* sceneId) {
-    if (!sceneId) return "";
+    if (!sceneId || !CatalogReady()) return "";
     OStimNavigator::OStimNetIntegration::LoadAnimationDescriptions();
     const auto* descEntry = OStimNavigator::OStimNetMetaData::GetSingleton().GetEffectiveDescription(sceneId);
     if (!descEntry || descEntry->description.empty()) return "";
@@ -207,13 +193,18 @@ bool ONavIsIdle(const char* sceneId) {
         SKSE::log::debug("ONavIsIdle: called with null sceneId -> false");
         return false;
     }
+    if (!CatalogReady()) {
+        SKSE::log::debug("ONavIsIdle: scene catalog not ready -> false");
+        return false;
+    }
     const auto* scene = OStimNavigator::SceneDatabase::GetSingleton().GetSceneByID(sceneId);
     if (!scene) {
         SKSE::log::debug("ONavIsIdle: scene '{}' not found -> false", sceneId);
         return false;
     }
+    static const auto idleTag = OStimNavigator::Symbol::Intern("idle");
     for (const auto& tag : scene->tags) {
-        if (tag == "idle") {
+        if (tag == idleTag) {
             SKSE::log::debug("ONavIsIdle: scene '{}' has tag 'idle' -> true", sceneId);
             return true;
         }
@@ -228,13 +219,18 @@ bool ONavIsIntro(const char* sceneId) {
         SKSE::log::debug("ONavIsIntro: called with null sceneId -> false");
         return false;
     }
+    if (!CatalogReady()) {
+        SKSE::log::debug("ONavIsIntro: scene catalog not ready -> false");
+        return false;
+    }
     const auto* scene = OStimNavigator::SceneDatabase::GetSingleton().GetSceneByID(sceneId);
     if (!scene) {
         SKSE::log::debug("ONavIsIntro: scene '{}' not found -> false", sceneId);
         return false;
     }
+    static const auto introTag = OStimNavigator::Symbol::Intern("intro");
     for (const auto& tag : scene->tags) {
-        if (tag == "intro") {
+        if (tag == introTag) {
             SKSE::log::debug("ONavIsIntro: scene '{}' has tag 'intro' -> true", sceneId);
             return true;
         }
@@ -249,6 +245,10 @@ bool ONavIsTransit(const char* sceneId) {
         SKSE::log::debug("ONavIsTransit: called with null sceneId -> false");
         return false;
     }
+    if (!CatalogReady()) {
+        SKSE::log::debug("ONavIsTransit: scene catalog not ready -> false");
+        return false;
+    }
     const auto* scene = OStimNavigator::SceneDatabase::GetSingleton().GetSceneByID(sceneId);
     if (!scene) {
         SKSE::log::debug("ONavIsTransit: scene '{}' not found -> false", sceneId);
@@ -320,7 +320,7 @@ namespace {
 
 extern "C" __declspec(dllexport)
 const char* ONavGetCumTargets(const char* sceneId, int actorPosition) {
-    if (!sceneId) return "[]";
+    if (!sceneId || !CatalogReady()) return "[]";
     const auto* scene = OStimNavigator::SceneDatabase::GetSingleton().GetSceneByID(sceneId);
     if (!scene) return "[]";
 
@@ -357,7 +357,7 @@ const char* ONavGetPositionDisplayNames() {
         // Escape quotes inside display strings
         std::string escaped;
         for (char c : display) { if (c == '"') escaped += "\\\""; else escaped += c; }
-        json += "\"" + id + "\":\"" + escaped + "\"";
+        json += "\"" + std::string(id) + "\":\"" + escaped + "\"";
     }
     json += "}";
     static std::string s_result;
@@ -372,7 +372,7 @@ const char* ONavGetPositionAliases() {
     for (const auto& [alias, canonical] : OStimNavigatorAPI::kPositionAliases) {
         if (!first) json += ",";
         first = false;
-        json += "\"" + alias + "\":\"" + canonical + "\"";
+        json += "\"" + std::string(alias) + "\":\"" + std::string(canonical) + "\"";
     }
     json += "}";
     static std::string s_result;
@@ -382,6 +382,7 @@ const char* ONavGetPositionAliases() {
 
 extern "C" __declspec(dllexport)
 const char* ONavGetCanonicalPositions() {
+    if (!CatalogReady()) return "[]";
     const auto& positions = OStimNavigator::OStimNetMetaData::GetSingleton().GetPositionSuggestions();
     std::string json = "[";
     for (size_t i = 0; i < positions.size(); ++i) {
@@ -396,6 +397,7 @@ const char* ONavGetCanonicalPositions() {
 
 extern "C" __declspec(dllexport)
 const char* ONavGetAllPositions() {
+    if (!CatalogReady()) return "[]";
     auto positions = OStimNavigator::SceneDatabase::GetSingleton().GetAllPositions();
     std::string json = "[";
     for (size_t i = 0; i < positions.size(); ++i) {
@@ -410,6 +412,7 @@ const char* ONavGetAllPositions() {
 
 extern "C" __declspec(dllexport)
 const char* ONavGetAllActions(const char* tag) {
+    if (!CatalogReady()) return "[]";
     std::vector<std::string> actions;
     if (tag && tag[0] != '\0') {
         auto withTag = OStimNavigator::ActionDatabase::GetSingleton().GetActionsWithTag(tag);
@@ -432,6 +435,7 @@ const char* ONavGetAllActions(const char* tag) {
 
 extern "C" __declspec(dllexport)
 const char* ONavGetFurnitureTypesWithSexScenes(uint32_t minSceneCount, uint32_t centerRefID, float radius) {
+    if (!CatalogReady()) return "[]";
     if (minSceneCount == 0) minSceneCount = 1;
 
     // id -> minimum distance to a matching nearby ref (-1.0 when no scan)
@@ -483,13 +487,13 @@ const char* ONavGetFurnitureTypesWithSexScenes(uint32_t minSceneCount, uint32_t
 // metadata tags authored in the scene JSON. Returns "[]" if the scene is unknown.
 extern "C" __declspec(dllexport)
 const char* ONavGetSceneTags(const char* sceneId) {
-    if (!sceneId || sceneId[0] == '\0') return "[]";
+    if (!sceneId || sceneId[0] == '\0' || !CatalogReady()) return "[]";
     const auto* scene = OStimNavigator::SceneDatabase::GetSingleton().GetSceneByID(sceneId);
     if (!scene || scene->tags.empty()) return "[]";
     std::string json = "[";
     for (size_t i = 0; i < scene->tags.size(); ++i) {
         if (i > 0) json += ",";
-        json += "\"" + scene->tags[i] + "\"";
+        json += "\"" + scene->tags[i].str() + "\"";
     }
     json += "]";
     static std::string s_result;
@@ -499,7 +503,7 @@ const char* ONavGetSceneTags(const char* sceneId) {
 
 extern "C" __declspec(dllexport)
 const char* ONavGetSceneActions(const char* sceneId) {
-    if (!sceneId || sceneId[0] == '\0') {
+    if (!sceneId || sceneId[0] == '\0' || !CatalogReady()) {
         static const char* s_empty = "[]";
         return s_empty;
     }
@@ -510,10 +514,10 @@ const char* ONavGetSceneActions(const char* sceneId) {
     }
     // Collect unique resolved action types for this scene, preserving order of first appearance.
     std::vector<std::string> actions;
-    std::unordered_set<std::string> seen;
+    std::unordered_set<OStimNavigator::Symbol> seen;
     for (const auto& action : scene->actions) {
         if (!action.type.empty() && seen.insert(action.type).second) {
-            actions.push_back(action.type);
+            actions.push_back(action.type.str());
         }
     }
     std::string json = "[";
@@ -532,7 +536,7 @@ const char* ONavGetSceneActions(const char* sceneId) {
 // @return true if the scene has a non-empty furnitureType; false if no furniture or scene unknown.
 extern "C" __declspec(dllexport)
 bool ONavSceneHasFurniture(const char* sceneId) {
-    if (!sceneId || sceneId[0] == '\0') return false;
+    if (!sceneId || sceneId[0] == '\0' || !CatalogReady()) return false;
     const auto* scene = OStimNavigator::SceneDatabase::GetSingleton().GetSceneByID(sceneId);
     if (!scene) return false;
     return !scene->furnitureType.empty();
@@ -544,11 +548,14 @@ bool ONavSceneHasFurniture(const char* sceneId) {
 // @return true if at least one actor position in the scene carries this tag; false otherwise.
 extern "C" __declspec(dllexport)
 bool ONavSceneHasActorWithTag(const char* sceneId, const char* tag) {
-    if (!sceneId || !tag || sceneId[0] == '\0' || tag[0] == '\0') return false;
+    if (!sceneId || !tag || sceneId[0] == '\0' || tag[0] == '\0' || !CatalogReady()) return false;
     const auto* scene = OStimNavigator::SceneDatabase::GetSingleton().GetSceneByID(sceneId);
     if (!scene) return false;
+    // A tag that was never interned is on no scene
+    auto symbol = OStimNavigator::Symbol::Find(tag);
+    if (!symbol) return false;
     for (const auto& actor : scene->actors) {
-        if (std::find(actor.tags.begin(), actor.tags.end(), tag) != actor.tags.end())
+        if (std::find(actor.tags.begin(), actor.tags.end(), *symbol) != actor.tags.end())
             return true;
     }
     return false;
@@ -570,7 +577,7 @@ bool ONavSceneHasActorWithTag(const char* sceneId, const char* tag) {
 // @note Not thread-safe. Call only from the SKSE game thread.
 extern "C" __declspec(dllexport)
 int ONavGetScenePhaseRank(const char* sceneId) {
-    if (!sceneId || sceneId[0] == '\0') return -1;
+    if (!sceneId || sceneId[0] == '\0' || !CatalogReady()) return -1;
     const auto* scene = OStimNavigator::SceneDatabase::GetSingleton().GetSceneByID(sceneId);
     if (!scene) return -1;
 
@@ -583,22 +590,30 @@ int ONavGetScenePhaseRank(const char* sceneId) {
         "suckingnipple",    // nipple sucking
     };
 
+    using OStimNavigator::Symbol;
+    static const Symbol intercourse = Symbol::Intern("intercourse");
+    static const Symbol oral = Symbol::Intern("oral");
+    static const Symbol penileStimulation = Symbol::Intern("penilestimulation");
+    static const Symbol fingering = Symbol::Intern("fingering");
+    static const Symbol toying = Symbol::Intern("toying");
+    static const Symbol clitoralStimulation = Symbol::Intern("clitoralstimulation");
+
     int maxRank = -1;
 
     for (const auto& action : scene->actions) {
         if (action.type.empty()) continue;
 
         int rank = -1;
-        if (actionDB.ActionHasTag(action.type, "intercourse")) {
+        if (actionDB.ActionHasTag(action.type, intercourse)) {
             rank = 3;
-        } else if (actionDB.ActionHasTag(action.type, "oral") &&
-                   !kOralButForeplay.count(action.type)) {
+        } else if (actionDB.ActionHasTag(action.type, oral) &&
+                   !kOralButForeplay.count(action.type.str())) {
             rank = 2;
-        } else if (actionDB.ActionHasTag(action.type, "penilestimulation") ||
-                   actionDB.ActionHasTag(action.type, "fingering") ||
-                   actionDB.ActionHasTag(action.type, "toying") ||
-                   actionDB.ActionHasTag(action.type, "clitoralstimulation") ||
-                   kOralButForeplay.count(action.type)) {
+        } else if (actionDB.ActionHasTag(action.type, penileStimulation) ||
+                   actionDB.ActionHasTag(action.type, fingering) ||
+                   actionDB.ActionHasTag(action.type, toying) ||
+                   actionDB.ActionHasTag(action.type, clitoralStimulation) ||
+                   kOralButForeplay.count(action.type.str())) {
             rank = 1;
         }
 
@@ -610,3 +625,31 @@ int ONavGetScenePhaseRank(const char* sceneId) {
 
     return maxRank;
 }
+
+// Fuzzy scene search over names, IDs, modpacks and scene tags, tolerating typos.
+// Returns a JSON array of {"id","score"} objects, best match first, at most
+// maxResults long (0 = no limit). Returns "[]" for an empty query or no match.
+extern "C" __declspec(dllexport)
+const char* ONavSearchScenes(const char* query, uint32_t maxResults) {
+    if (!query || query[0] == '\0' || !CatalogReady()) return "[]";
+    auto& sceneDB = OStimNavigator::SceneDatabase::GetSingleton();
+    const auto& columns = sceneDB.GetColumns();
+    auto hits = sceneDB.GetSearchIndex().FuzzySearch(query, maxResults);
+    std::string json = "[";
+    for (size_t i = 0; i < hits.size(); ++i) {
+        if (i > 0) json += ",";
+        json += "{\"id\":\"" + columns.scenes[hits[i].index]->id + "\",\"score\":" + std::to_string(hits[i].score) + "}";
+    }
+    json += "]";
+    static std::string s_result;
+    s_result = std::move(json);
+    return s_result.c_str();
+}
+
+// Returns the scene catalog load state: "loading", "ready", "failed" or "not loaded".
+// Scene-based exports return their empty/unknown value until this is "ready".
+extern "C" __declspec(dllexport)
+const char* ONavGetCatalogState() {
+    auto& sceneDB = OStimNavigator::SceneDatabase::GetSingleton();
+    return OStimNavigator::SceneDatabase::LoadStateName(sceneDB.GetLoadState());
+}
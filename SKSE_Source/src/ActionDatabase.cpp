@@ -4,7 +4,6 @@
 #include "StringUtils.h"
 #include "JsonUtils.h"
 #include <nlohmann/json.hpp>
-#include <fstream>
 #include <functional>
 #include <algorithm>
 
@@ -19,17 +18,37 @@ namespace OStimNavigator {
 
         m_actions.clear();
         m_aliases.clear();
+        m_actionsBySymbol.clear();
         m_allTags.clear();
         m_tagBuckets.clear();
         m_availableInScenes.clear();
+        m_requirementBits.clear();
+        m_requirementWords = 0;
 
         // Path to OStim actions directory
         std::filesystem::path actionsPath = "Data/SKSE/Plugins/OStim/actions";
         
+        JsonUtils::ReadStats stats;
         JsonUtils::LoadJsonFilesFromDirectory(actionsPath, 
-            [this](const std::filesystem::path& path) {
-                ParseActionFile(path);
+            [this, &stats](const std::filesystem::path& path) {
+                ParseActionFile(path, stats);
             });
+        stats.Log("ActionDatabase");
+
+        // m_actions is complete, so its element addresses are stable from here on.
+        // Each key maps to whatever FindAction resolves it to.
+        for (const auto& [type, _] : m_actions) {
+            if (const ActionData* action = FindAction(type)) {
+                m_actionsBySymbol[Symbol::Intern(type)] = action;
+            }
+        }
+        for (const auto& [alias, _] : m_aliases) {
+            if (const ActionData* action = FindAction(alias)) {
+                m_actionsBySymbol[Symbol::Intern(alias)] = action;
+            }
+        }
+
+        BuildRequirementMasks();
 
         for (const auto& [type, _] : m_actions) {
             if (!FindActionPhrase(type)) {
@@ -41,17 +60,14 @@ namespace OStimNavigator {
         m_loaded = true;
     }
 
-    void ActionDatabase::ParseActionFile(const std::filesystem::path& filePath) {
+    void ActionDatabase::ParseActionFile(const std::filesystem::path& filePath, JsonUtils::ReadStats& stats) {
         try {
-            std::ifstream file(filePath);
-            if (!file.is_open()) {
+            json j;
+            if (!JsonUtils::ParseFile(filePath, j, &stats)) {
                 SKSE::log::warn("Failed to open action file: {}", filePath.string());
                 return;
             }
 
-            json j;
-            file >> j;
-
             ActionData action;
             action.type = filePath.stem().string();
             StringUtils::ToLower(action.type);
@@ -76,7 +92,7 @@ namespace OStimNavigator {
 
     void ActionDatabase::ParseTags(const nlohmann::json& j, ActionData& action) {
         ParseJsonStringArray(j, "tags", [&](const std::string& tag) {
-            action.tags.push_back(tag);
+            action.tags.push_back(Symbol::Intern(tag));
             m_allTags.insert(tag);
             m_tagBuckets[tag].insert(action.type);
         });
@@ -115,6 +131,41 @@ namespace OStimNavigator {
         return requirements;
     }
 
+    void ActionDatabase::BuildRequirementMasks() {
+        // Bits in name order, so a mask means the same from one launch to the next
+        std::vector<std::string> names;
+        for (const auto& [type, action] : m_actions) {
+            for (const auto* roleRequirements : { &action.actorRequirements, &action.targetRequirements, &action.performerRequirements }) {
+                names.insert(names.end(), roleRequirements->begin(), roleRequirements->end());
+            }
+        }
+        std::sort(names.begin(), names.end());
+        names.erase(std::unique(names.begin(), names.end()), names.end());
+
+        for (uint32_t bit = 0; bit < names.size(); ++bit) {
+            m_requirementBits[names[bit]] = bit;
+        }
+        m_requirementWords = static_cast<uint32_t>((names.size() + 63) / 64);
+
+        for (auto& [type, action] : m_actions) {
+            action.actorRequirementMask = GetRequirementMask(action.actorRequirements);
+            action.targetRequirementMask = GetRequirementMask(action.targetRequirements);
+            action.performerRequirementMask = GetRequirementMask(action.performerRequirements);
+        }
+        SKSE::log::info("ActionDatabase: {} requirement names", m_requirementBits.size());
+    }
+
+    RequirementMask ActionDatabase::GetRequirementMask(const std::unordered_set<std::string>& requirements) const {
+        RequirementMask mask(m_requirementWords, 0);
+        for (const auto& requirement : requirements) {
+            auto it = m_requirementBits.find(requirement);
+            if (it != m_requirementBits.end()) {
+                mask[it->second / 64] |= uint64_t{ 1 } << (it->second % 64);
+            }
+        }
+        return mask;
+    }
+
     std::string ActionDatabase::ResolveActionType(const std::string& typeOrAlias) const {
         std::string lower = StringUtils::ToLowerCopy(typeOrAlias);
         
@@ -144,26 +195,42 @@ namespace OStimNavigator {
         return (it != m_actions.end()) ? &it->second : nullptr;
     }
 
+    const ActionData* ActionDatabase::GetAction(Symbol type) const {
+        auto it = m_actionsBySymbol.find(type.Folded());
+        return (it != m_actionsBySymbol.end()) ? it->second : nullptr;
+    }
+
     bool ActionDatabase::ActionHasTag(const std::string& type, const std::string& tag) const {
         const ActionData* action = FindAction(type);
         if (!action) return false;
 
-        std::string lowerTag = StringUtils::ToLowerCopy(tag);
-        return std::find(action->tags.begin(), action->tags.end(), lowerTag) != action->tags.end();
+        // A tag that was never interned is on no action
+        auto lowerTag = Symbol::Find(StringUtils::ToLowerCopy(tag));
+        return lowerTag && std::find(action->tags.begin(), action->tags.end(), *lowerTag) != action->tags.end();
+    }
+
+    bool ActionDatabase::ActionHasTag(Symbol type, Symbol tag) const {
+        const ActionData* action = GetAction(type);
+        return action && std::find(action->tags.begin(), action->tags.end(), tag.Folded()) != action->tags.end();
     }
     
     std::vector<std::string> ActionDatabase::GetActionTags(const std::string& typeOrAlias) const {
-        const ActionData* action = FindAction(typeOrAlias);
-        return action ? action->tags : std::vector<std::string>{};
+        std::vector<std::string> tags;
+        if (const ActionData* action = FindAction(typeOrAlias)) {
+            tags.reserve(action->tags.size());
+            for (Symbol tag : action->tags) {
+                tags.push_back(tag.str());
+            }
+        }
+        return tags;
     }
     
-    std::unordered_set<std::string> ActionDatabase::GetTagsFromActions(const std::vector<SceneActionData>& actions) const {
-        std::unordered_set<std::string> allTags;
+    std::unordered_set<Symbol> ActionDatabase::GetTagsFromActions(std::span<const SceneActionData> actions) const {
+        std::unordered_set<Symbol> allTags;
         
         for (const auto& action : actions) {
-            auto actionTags = GetActionTags(action.type);
-            for (const auto& tag : actionTags) {
-                allTags.insert(tag);
+            if (const ActionData* data = GetAction(action.type)) {
+                allTags.insert(data->tags.begin(), data->tags.end());
             }
         }
         
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "PCH.h"
+#include "SymbolTable.h"
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -12,19 +15,30 @@ namespace OStimNavigatorAPI {
 }
 
 namespace OStimNavigator {
+    namespace JsonUtils { struct ReadStats; }
     
     // Forward declaration
     struct SceneActionData;
+
+    // A set of requirement names, one bit per name in the requirement
+    // vocabulary (see ActionDatabase::GetRequirementMask). Every mask has
+    // ActionDatabase::RequirementWords() words.
+    using RequirementMask = std::vector<uint64_t>;
     
     struct ActionData {
         std::string type;                               // Main action type (e.g., "vaginalsex")
         std::vector<std::string> aliases;               // Aliases (e.g., "sex")
-        std::vector<std::string> tags;                  // Action tags
+        std::vector<Symbol> tags;                       // Action tags
         
         // Requirements per role
         std::unordered_set<std::string> actorRequirements;
         std::unordered_set<std::string> targetRequirements;
         std::unordered_set<std::string> performerRequirements;
+
+        // The same requirements as masks
+        RequirementMask actorRequirementMask;
+        RequirementMask targetRequirementMask;
+        RequirementMask performerRequirementMask;
     };
 
     class ActionDatabase {
@@ -42,15 +56,21 @@ namespace OStimNavigator {
 
         // Get action data by type
         ActionData* GetAction(const std::string& type);
+
+        // Get action data by an interned type or alias (no string hashing or lowercasing)
+        const ActionData* GetAction(Symbol type) const;
         
         // Check if an action has a specific tag
         bool ActionHasTag(const std::string& type, const std::string& tag) const;
+
+        // Check if an action has a specific tag, by interned type or alias and tag
+        bool ActionHasTag(Symbol type, Symbol tag) const;
         
         // Get tags for a specific action type
         std::vector<std::string> GetActionTags(const std::string& typeOrAlias) const;
         
         // Get all unique tags from multiple actions
-        std::unordered_set<std::string> GetTagsFromActions(const std::vector<SceneActionData>& actions) const;
+        std::unordered_set<Symbol> GetTagsFromActions(std::span<const SceneActionData> actions) const;
 
         // Stats
         size_t GetActionCount() const { return m_actions.size(); }
@@ -77,13 +97,20 @@ namespace OStimNavigator {
         // Find ActionPhrase by checking type and aliases
         const OStimNavigatorAPI::ActionPhrase* FindActionPhrase(const std::string& type) const;
 
+        // Requirement names as a mask. Every name an action role asks for gets
+        // a bit at load; other names are dropped, as no role can ask for them.
+        RequirementMask GetRequirementMask(const std::unordered_set<std::string>& requirements) const;
+
+        // Words in every requirement mask, fixed once the actions are loaded
+        uint32_t RequirementWords() const { return m_requirementWords; }
+
     private:
         ActionDatabase() = default;
         ~ActionDatabase() = default;
         ActionDatabase(const ActionDatabase&) = delete;
         ActionDatabase& operator=(const ActionDatabase&) = delete;
 
-        void ParseActionFile(const std::filesystem::path& filePath);
+        void ParseActionFile(const std::filesystem::path& filePath, JsonUtils::ReadStats& stats);
         void ParseAliases(const nlohmann::basic_json<>& j, ActionData& action);
         void ParseTags(const nlohmann::basic_json<>& j, ActionData& action);
         void ParseRoleRequirements(const nlohmann::basic_json<>& j, ActionData& action);
@@ -91,12 +118,16 @@ namespace OStimNavigator {
                                   std::function<void(const std::string&)> callback);
         std::unordered_set<std::string> ParseActorRequirements(const nlohmann::basic_json<>& actorJson);
         const ActionData* FindAction(const std::string& typeOrAlias) const;
+        void BuildRequirementMasks();
 
         std::unordered_map<std::string, ActionData> m_actions;      // type -> ActionData
         std::unordered_map<std::string, std::string> m_aliases;     // alias -> type
+        std::unordered_map<Symbol, const ActionData*> m_actionsBySymbol; // type or alias -> action
         std::unordered_set<std::string> m_allTags;
         std::unordered_map<std::string, std::unordered_set<std::string>> m_tagBuckets; // tag -> set of action types
         std::unordered_set<std::string> m_availableInScenes;         // action types that appear in at least one scene
+        std::unordered_map<std::string, uint32_t> m_requirementBits; // requirement name -> bit
+        uint32_t m_requirementWords = 0;
         bool m_loaded = false;
     };
 }
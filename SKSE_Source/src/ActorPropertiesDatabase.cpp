@@ -4,7 +4,6 @@
 #include "JsonUtils.h"
 #include <nlohmann/json.hpp>
 #include <filesystem>
-#include <fstream>
 
 namespace OStimNavigator {
 
@@ -15,28 +14,27 @@ namespace OStimNavigator {
         std::filesystem::path basePath = "Data/SKSE/Plugins/OStim/actor properties";
         
         int loadedCount = 0;
+        JsonUtils::ReadStats stats;
         JsonUtils::LoadJsonFilesFromDirectory(basePath,
-            [this, &loadedCount](const std::filesystem::path& path) {
-                ParsePropertyFile(path);
+            [this, &loadedCount, &stats](const std::filesystem::path& path) {
+                ParsePropertyFile(path, stats);
                 loadedCount++;
             },
             true);  // recursive
+        stats.Log("ActorPropertiesDatabase");
 
         m_loaded = true;
         SKSE::log::info("Loaded {} actor property files", loadedCount);
     }
 
-    void ActorPropertiesDatabase::ParsePropertyFile(const std::filesystem::path& filePath) {
+    void ActorPropertiesDatabase::ParsePropertyFile(const std::filesystem::path& filePath, JsonUtils::ReadStats& stats) {
         try {
-            std::ifstream file(filePath);
-            if (!file.is_open()) {
+            nlohmann::json json;
+            if (!JsonUtils::ParseFile(filePath, json, &stats)) {
                 SKSE::log::warn("Failed to open actor property file: {}", filePath.string());
                 return;
             }
 
-            nlohmann::json json;
-            file >> json;
-
             ActorPropertyData data;
             ParseCondition(json, data);
             ParseActorType(json, data);
@@ -121,6 +119,22 @@ namespace OStimNavigator {
         return requirements;
     }
 
+    RequirementMask ActorPropertiesDatabase::GetActorRequirementMask(RE::Actor* actor) const {
+        if (!actor) {
+            return RequirementMask(ActionDatabase::GetSingleton().RequirementWords(), ~uint64_t{ 0 });
+        }
+
+        RE::FormID actorFormID = actor->GetFormID();
+        auto cacheIt = m_maskCache.find(actorFormID);
+        if (cacheIt != m_maskCache.end()) {
+            return cacheIt->second;
+        }
+
+        RequirementMask mask = ActionDatabase::GetSingleton().GetRequirementMask(GetActorRequirements(actor));
+        m_maskCache[actorFormID] = mask;
+        return mask;
+    }
+
     bool ActorPropertiesDatabase::EvaluateCondition(const ActorPropertyData& property, RE::Actor* actor) const {
         if (property.conditionFormID == 0) {
             return true;  // No condition means always true
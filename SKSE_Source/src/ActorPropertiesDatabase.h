@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PCH.h"
+#include "ActionDatabase.h"
 #include <nlohmann/json_fwd.hpp>
 #include <unordered_map>
 #include <unordered_set>
@@ -8,6 +9,7 @@
 #include <vector>
 
 namespace OStimNavigator {
+    namespace JsonUtils { struct ReadStats; }
 
     struct ActorPropertyData {
         RE::FormID conditionFormID = 0;
@@ -29,9 +31,16 @@ namespace OStimNavigator {
 
         // Get requirements for a specific actor based on perks/conditions
         std::unordered_set<std::string> GetActorRequirements(RE::Actor* actor) const;
+
+        // The same requirements as an ActionDatabase requirement mask.
+        // nullptr actors meet every requirement (all bits set).
+        RequirementMask GetActorRequirementMask(RE::Actor* actor) const;
         
         // Clear the evaluation cache (call when needed, e.g., when actors change)
-        void ClearCache() const { m_cache.clear(); }
+        void ClearCache() const {
+            m_cache.clear();
+            m_maskCache.clear();
+        }
 
     private:
         ActorPropertiesDatabase() = default;
@@ -39,7 +48,7 @@ namespace OStimNavigator {
         ActorPropertiesDatabase(const ActorPropertiesDatabase&) = delete;
         ActorPropertiesDatabase& operator=(const ActorPropertiesDatabase&) = delete;
 
-        void ParsePropertyFile(const std::filesystem::path& filePath);
+        void ParsePropertyFile(const std::filesystem::path& filePath, JsonUtils::ReadStats& stats);
         void ParseCondition(const nlohmann::json& json, ActorPropertyData& data);
         void ParseActorType(const nlohmann::json& json, ActorPropertyData& data);
         void ParseRequirements(const nlohmann::json& json, ActorPropertyData& data);
@@ -52,6 +61,7 @@ namespace OStimNavigator {
         
         // Cache of evaluated requirements per actor (mutable so const methods can use it)
         mutable std::unordered_map<RE::FormID, std::unordered_set<std::string>> m_cache;
+        mutable std::unordered_map<RE::FormID, RequirementMask> m_maskCache;
     };
 
 }
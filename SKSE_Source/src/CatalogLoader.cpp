@@ -0,0 +1,97 @@
+#include "CatalogLoader.h"
+#include "ActionDatabase.h"
+#include "ActorPropertiesDatabase.h"
+#include "FurnitureDatabase.h"
+#include "OStimNavigator_PublicAPI.h"
+#include "OStimNetMetaData.h"
+#include "SceneDatabase.h"
+#include "SceneTagWriter.h"
+#include "Settings.h"
+#include "StartupScheduler.h"
+
+namespace OStimNavigator {
+    namespace CatalogLoader {
+
+        namespace {
+            // Game thread. Publishes the final state, then tells other plugins.
+            void Finish(bool ok) {
+                auto& sceneDB = SceneDatabase::GetSingleton();
+                sceneDB.SetLoadState(ok ? SceneDatabase::LoadState::Ready : SceneDatabase::LoadState::Failed);
+
+                if (!ok) {
+                    SKSE::log::error("CatalogLoader: scene catalog failed to load");
+                    if (auto* console = RE::ConsoleLog::GetSingleton()) {
+                        console->Print("OstimNavigator: scene catalog failed to load, see OstimNavigator.log");
+                    }
+                } else {
+                    SKSE::log::info("CatalogLoader: scene catalog ready ({} scenes)", sceneDB.GetSceneCount());
+                    SceneTagWriter::Start();
+                    if (auto* console = RE::ConsoleLog::GetSingleton()) {
+                        console->Print("OstimNavigator: Ready");
+                    }
+                }
+
+                // Broadcast to other SKSE plugins listening to "OStimNavigator"
+                if (auto* messaging = SKSE::GetMessagingInterface()) {
+                    messaging->Dispatch(ok ? OStimNavigatorAPI::kMessageCatalogReady
+                                           : OStimNavigatorAPI::kMessageCatalogFailed,
+                                        nullptr, 0, nullptr);
+                }
+            }
+        }
+
+        void Start() {
+            auto& sceneDB = SceneDatabase::GetSingleton();
+            if (sceneDB.GetLoadState() != SceneDatabase::LoadState::NotLoaded) {
+                return;
+            }
+            sceneDB.SetLoadState(SceneDatabase::LoadState::Loading);
+
+            // Independent loaders run concurrently; scenes start as soon as
+            // actions, furniture and scene meta are ready.
+            using Affinity = StartupScheduler::Affinity;
+            StartupScheduler scheduler;
+
+            // Furniture types resolve keywords, form lists and factions, so they
+            // stay on the game thread
+            scheduler.Add("furniture", {}, [] {
+                FurnitureDatabase::GetSingleton().LoadFurnitureTypes();
+            }, Affinity::GameThread);
+
+            scheduler.Add("actions", {}, [] {
+                ActionDatabase::GetSingleton().LoadActions();
+            });
+
+            scheduler.Add("actor properties", {}, [] {
+                ActorPropertiesDatabase::GetSingleton().LoadActorProperties();
+            });
+
+            // Animation descriptions
+            scheduler.Add("descriptions", {}, [] {
+                OStimNetMetaData::GetSingleton().LoadDescriptions();
+            });
+
+            scheduler.Add("scene meta", {}, [] {
+                OStimNetMetaData::GetSingleton().LoadSceneMeta();
+            });
+
+            // Scenes resolve action aliases, count furniture scenes and merge scene meta
+            scheduler.Add("scenes", { "furniture", "actions", "scene meta" }, [] {
+                SceneDatabase::GetSingleton().LoadScenes();
+            });
+
+            // Auto-populate positions in scene meta from scene tags (skips scenes that already have positions)
+            scheduler.Add("positions", { "scenes", "scene meta" }, [] {
+                OStimNetMetaData::GetSingleton().AutoPopulatePositions();
+            });
+
+            const auto& settings = Settings::GetSingleton();
+            if (settings.asyncCatalogLoad) {
+                SKSE::log::info("CatalogLoader: loading scene catalog in the background");
+                scheduler.RunAsync(settings.parallelStartup, Finish);
+            } else {
+                Finish(scheduler.Run(settings.parallelStartup));
+            }
+        }
+    }
+}
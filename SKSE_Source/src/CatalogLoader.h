@@ -0,0 +1,14 @@
+#pragma once
+
+#include "PCH.h"
+
+namespace OStimNavigator {
+    namespace CatalogLoader {
+        // Load every database (actions, furniture, actor properties, OStimNet data,
+        // scenes). Call once at kDataLoaded on the game thread. With
+        // Settings::asyncCatalogLoad the catalog builds in the background and this
+        // returns immediately; SceneDatabase::GetLoadState() reports Loading until
+        // it is done.
+        void Start();
+    }
+}
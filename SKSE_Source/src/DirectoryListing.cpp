@@ -0,0 +1,38 @@
+#include "DirectoryListing.h"
+
+namespace OStimNavigator {
+    namespace DirectoryListing {
+
+        namespace {
+            // Pre-order, like recursive_directory_iterator: a subfolder's files
+            // come right where the subfolder appears in its parent.
+            void Walk(const std::filesystem::path& directory, bool recursive, std::vector<JsonFile>& files) {
+                for (const auto& dirEntry : std::filesystem::directory_iterator(directory)) {
+                    if (dirEntry.is_directory() && !dirEntry.is_symlink()) {
+                        if (recursive) {
+                            Walk(dirEntry.path(), true, files);
+                        }
+                        continue;
+                    }
+                    if (!dirEntry.is_regular_file() || dirEntry.path().extension() != ".json") {
+                        continue;
+                    }
+
+                    JsonFile& file = files.emplace_back();
+                    file.path = dirEntry.path();
+                    std::error_code ec;
+                    file.size = dirEntry.file_size(ec);
+                    if (ec) file.size = 0;
+                    auto fileTime = dirEntry.last_write_time(ec);
+                    file.mtime = ec ? 0 : static_cast<int64_t>(fileTime.time_since_epoch().count());
+                }
+            }
+        }
+
+        std::vector<JsonFile> ListJsonFiles(const std::filesystem::path& directory, bool recursive) {
+            std::vector<JsonFile> files;
+            Walk(directory, recursive, files);
+            return files;
+        }
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "PCH.h"
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+/*
+ * One-pass listing of the .json files under the data folders.
+ *
+ * Every folder is enumerated once, and each file's size and mtime are taken
+ * from its directory entry, which the enumeration already filled in. Loaders
+ * get path and stamp together and never stat a file a second time. Nothing
+ * is cached between launches: a file edited in place keeps its folder's
+ * mtime, so a cached listing could only hand out stale stamps.
+ */
+
+namespace OStimNavigator {
+    namespace DirectoryListing {
+
+        struct JsonFile {
+            std::filesystem::path path;
+            uint64_t size = 0;
+            int64_t mtime = 0;          // file_time_type ticks
+        };
+
+        // Every .json file in directory (and its subfolders when recursive), in
+        // the order recursive_directory_iterator yields them. Throws
+        // std::filesystem::filesystem_error if a folder cannot be enumerated.
+        std::vector<JsonFile> ListJsonFiles(const std::filesystem::path& directory, bool recursive);
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+/*
+ * Constant lookup tables keyed by string_view.
+ *
+ * Entries are sorted while compiling, so a table lives in read-only data with
+ * no static initializer and no heap use, and find() is a binary search over a
+ * contiguous array. Duplicate keys are rejected at compile time. The interface
+ * mirrors the std::unordered_map/set subset the tables are used with
+ * (find/end/count/contains/at and range-for), and iteration is in key order.
+ */
+
+namespace OStimNavigator {
+
+    template <typename Value, size_t N>
+    class FrozenMap {
+    public:
+        using value_type = std::pair<std::string_view, Value>;
+        using const_iterator = const value_type*;
+
+        consteval explicit FrozenMap(std::array<value_type, N> entries) : m_entries(entries) {
+            std::sort(m_entries.begin(), m_entries.end(),
+                [](const value_type& a, const value_type& b) { return a.first < b.first; });
+            for (size_t i = 1; i < N; ++i) {
+                if (m_entries[i - 1].first == m_entries[i].first) {
+                    throw "FrozenMap: duplicate key";
+                }
+            }
+        }
+
+        constexpr const_iterator begin() const { return m_entries.data(); }
+        constexpr const_iterator end() const { return m_entries.data() + N; }
+        constexpr size_t size() const { return N; }
+
+        constexpr const_iterator find(std::string_view key) const {
+            const_iterator it = std::lower_bound(begin(), end(), key,
+                [](const value_type& entry, std::string_view k) { return entry.first < k; });
+            return (it != end() && it->first == key) ? it : end();
+        }
+
+        constexpr bool contains(std::string_view key) const { return find(key) != end(); }
+        constexpr size_t count(std::string_view key) const { return contains(key) ? 1 : 0; }
+
+        const Value& at(std::string_view key) const {
+            const_iterator it = find(key);
+            if (it == end()) {
+                throw std::out_of_range("FrozenMap::at: key not found");
+            }
+            return it->second;
+        }
+
+    private:
+        std::array<value_type, N> m_entries;
+    };
+
+    template <size_t N>
+    class FrozenSet {
+    public:
+        using const_iterator = const std::string_view*;
+
+        consteval explicit FrozenSet(std::array<std::string_view, N> keys) : m_keys(keys) {
+            std::sort(m_keys.begin(), m_keys.end());
+            for (size_t i = 1; i < N; ++i) {
+                if (m_keys[i - 1] == m_keys[i]) {
+                    throw "FrozenSet: duplicate key";
+                }
+            }
+        }
+
+        constexpr const_iterator begin() const { return m_keys.data(); }
+        constexpr const_iterator end() const { return m_keys.data() + N; }
+        constexpr size_t size() const { return N; }
+
+        constexpr bool contains(std::string_view key) const { return std::binary_search(begin(), end(), key); }
+        constexpr size_t count(std::string_view key) const { return contains(key) ? 1 : 0; }
+
+    private:
+        std::array<std::string_view, N> m_keys;
+    };
+
+    // Deduce the size from a braced list:
+    //   inline constexpr auto kTable = MakeFrozenMap<std::string_view>({ {"key", "value"}, ... });
+    template <typename Value, size_t N>
+    consteval FrozenMap<Value, N> MakeFrozenMap(std::pair<std::string_view, Value> (&&entries)[N]) {
+        return FrozenMap<Value, N>(std::to_array(std::move(entries)));
+    }
+
+    template <size_t N>
+    consteval FrozenSet<N> MakeFrozenSet(std::string_view (&&keys)[N]) {
+        return FrozenSet<N>(std::to_array(std::move(keys)));
+    }
+}
@@ -3,7 +3,6 @@
 #include "StringUtils.h"
 #include "JsonUtils.h"
 #include <filesystem>
-#include <fstream>
 #include <limits>
 #include <nlohmann/json.hpp>
 
@@ -47,25 +46,23 @@ namespace OStimNavigator {
     }
 
     void FurnitureDatabase::LoadFurnitureTypesFromDirectory(const std::filesystem::path& directory) {
+        JsonUtils::ReadStats stats;
         JsonUtils::LoadJsonFilesFromDirectory(directory,
-            [this](const std::filesystem::path& path) {
-                ParseFurnitureFile(path);
+            [this, &stats](const std::filesystem::path& path) {
+                ParseFurnitureFile(path, stats);
             },
             true);  // recursive
+        stats.Log("FurnitureDatabase");
     }
 
-    void FurnitureDatabase::ParseFurnitureFile(const std::filesystem::path& filePath) {
+    void FurnitureDatabase::ParseFurnitureFile(const std::filesystem::path& filePath, JsonUtils::ReadStats& stats) {
         try {
-            std::ifstream file(filePath);
-            if (!file.is_open()) {
+            json j;
+            if (!JsonUtils::ParseFile(filePath, j, &stats)) {
                 SKSE::log::warn("Could not open furniture type file: {}", filePath.string());
                 return;
             }
 
-            json j;
-            file >> j;
-            file.close();
-
             // Get the furniture type ID from filename (without .json extension)
             std::string furnitureID = filePath.stem().string();
             StringUtils::ToLower(furnitureID);
@@ -365,6 +362,21 @@ namespace OStimNavigator {
         return compatible;
     }
 
+    bool FurnitureDatabase::IsSceneCompatible(const std::unordered_set<Symbol>& threadFurnitureTypes, Symbol sceneFurniture) {
+        Symbol sceneFurnitureLower = sceneFurniture.Folded();
+
+        if (threadFurnitureTypes.empty()) {
+            return sceneFurnitureLower.empty();
+        }
+
+        if (sceneFurnitureLower.empty()) {
+            return std::any_of(threadFurnitureTypes.begin(), threadFurnitureTypes.end(),
+                [](Symbol type) { return type.view().find("bed") != std::string_view::npos; });
+        }
+
+        return threadFurnitureTypes.count(sceneFurnitureLower) > 0;
+    }
+
     std::vector<std::string> FurnitureDatabase::GetAllFurnitureTypeIDs() const {
         std::vector<std::string> result;
         result.reserve(m_furnitureTypes.size());
@@ -381,4 +393,11 @@ namespace OStimNavigator {
             it->second.sceneCount++;
         }
     }
+
+    void FurnitureDatabase::DecrementSceneCount(const std::string& id) {
+        auto it = m_furnitureTypes.find(id);
+        if (it != m_furnitureTypes.end() && it->second.sceneCount > 0) {
+            it->second.sceneCount--;
+        }
+    }
 }
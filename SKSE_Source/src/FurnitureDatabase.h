@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PCH.h"
+#include "SymbolTable.h"
 #include <functional>
 #include <string>
 #include <unordered_map>
@@ -8,6 +9,7 @@
 #include <vector>
 
 namespace OStimNavigator {
+    namespace JsonUtils { struct ReadStats; }
     
     struct FurnitureTypeData {
         std::string id;                         // Furniture type ID
@@ -46,12 +48,16 @@ namespace OStimNavigator {
         // sceneFurniture: the furniture required by the scene
         // Returns true if compatible (handles bed edge case: bed furniture allows scenes with no furniture)
         bool IsSceneCompatible(const std::unordered_set<std::string>& threadFurnitureTypes, const std::string& sceneFurniture);
+        // Same check on interned IDs, for filtering many scenes against one thread
+        bool IsSceneCompatible(const std::unordered_set<Symbol>& threadFurnitureTypes, Symbol sceneFurniture);
         
         // Get all furniture type IDs
         std::vector<std::string> GetAllFurnitureTypeIDs() const;
 
         // Increment scene count for a furniture type (called by SceneDatabase during scene loading)
         void IncrementSceneCount(const std::string& id);
+        // Undo an increment (called by SceneDatabase when a reload replaces a scene)
+        void DecrementSceneCount(const std::string& id);
 
         // Stats
         size_t GetFurnitureTypeCount() const { return m_furnitureTypes.size(); }
@@ -64,7 +70,7 @@ namespace OStimNavigator {
         FurnitureDatabase& operator=(const FurnitureDatabase&) = delete;
 
         void LoadFurnitureTypesFromDirectory(const std::filesystem::path& directory);
-        void ParseFurnitureFile(const std::filesystem::path& filePath);
+        void ParseFurnitureFile(const std::filesystem::path& filePath, JsonUtils::ReadStats& stats);
         void ResolveSuperTypes();
         void ResolveFactions();
         void AddSuperTypes(std::unordered_set<std::string>& furnitureTypes, const FurnitureTypeData* furniture);
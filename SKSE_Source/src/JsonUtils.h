@@ -1,16 +1,23 @@
 #pragma once
 
+#include "DirectoryListing.h"
+#include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <functional>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
 
 namespace OStimNavigator {
     namespace JsonUtils {
         
-        // Load JSON files from a directory with a callback for each file
-        // Callback signature: void(const std::filesystem::path& filePath)
-        inline void LoadJsonFilesFromDirectory(
+        // Enumerate JSON files in a directory with a callback for each file.
+        // The file carries the size and last write time gathered during enumeration,
+        // so callers that need file stamps don't have to stat each file again.
+        inline void ForEachJsonFile(
             const std::filesystem::path& directory,
-            std::function<void(const std::filesystem::path&)> parseCallback,
+            std::function<void(const DirectoryListing::JsonFile&)> fileCallback,
             bool recursive = false) {
             
             if (!std::filesystem::exists(directory)) {
@@ -20,23 +27,82 @@ namespace OStimNavigator {
 
             SKSE::log::info("Loading JSON files from: {}", directory.string());
 
+            std::vector<DirectoryListing::JsonFile> files;
             try {
-                if (recursive) {
-                    for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
-                        if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                            parseCallback(entry.path());
-                        }
-                    }
-                } else {
-                    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
-                        if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                            parseCallback(entry.path());
-                        }
-                    }
-                }
+                files = DirectoryListing::ListJsonFiles(directory, recursive);
             } catch (const std::exception& e) {
                 SKSE::log::error("Error loading JSON files from {}: {}", directory.string(), e.what());
+                return;
+            }
+            for (const auto& file : files) {
+                fileCallback(file);
+            }
+        }
+
+        // Load JSON files from a directory with a callback for each file
+        // Callback signature: void(const std::filesystem::path& filePath)
+        inline void LoadJsonFilesFromDirectory(
+            const std::filesystem::path& directory,
+            std::function<void(const std::filesystem::path&)> parseCallback,
+            bool recursive = false) {
+            ForEachJsonFile(directory,
+                [&parseCallback](const DirectoryListing::JsonFile& file) {
+                    parseCallback(file.path);
+                },
+                recursive);
+        }
+
+        // Read a whole file into buffer with one sized read. The buffer keeps its
+        // capacity, so a loader can reuse it for every file.
+        inline bool ReadFile(const std::filesystem::path& path, std::string& buffer) {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file.is_open()) {
+                return false;
             }
+            const std::streamoff size = file.tellg();
+            if (size < 0) {
+                return false;
+            }
+            buffer.resize(static_cast<size_t>(size));
+            file.seekg(0);
+            file.read(buffer.data(), size);
+            buffer.resize(static_cast<size_t>(file.gcount()));
+            return true;
+        }
+
+        // Files and bytes a loader read, for its throughput log line.
+        struct ReadStats {
+            size_t files = 0;
+            size_t bytes = 0;
+            std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+
+            void Log(std::string_view loader) const {
+                auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - started).count();
+                double mbPerSec = us > 0 ? (bytes / (1024.0 * 1024.0)) / (us / 1e6) : 0.0;
+                SKSE::log::info("{}: read {} file(s), {} KB in {} ms ({:.1f} MB/s)",
+                    loader, files, bytes / 1024, us / 1000, mbPerSec);
+            }
+        };
+
+        // Read and parse a JSON file from contiguous memory. Returns false if the
+        // file could not be opened; throws nlohmann::json::parse_error on invalid
+        // JSON. Like `file >> j`, anything after the first JSON value is ignored.
+        inline bool ParseFile(const std::filesystem::path& path, nlohmann::json& j, ReadStats* stats = nullptr) {
+            thread_local std::string buffer;
+            if (!ReadFile(path, buffer)) {
+                return false;
+            }
+            if (stats) {
+                ++stats->files;
+                stats->bytes += buffer.size();
+            }
+
+            j = nlohmann::json();
+            nlohmann::detail::json_sax_dom_parser<nlohmann::json> sax(j);
+            nlohmann::json::sax_parse(buffer.data(), buffer.data() + buffer.size(), &sax,
+                                      nlohmann::json::input_format_t::json, false);
+            return true;
         }
     }
 }
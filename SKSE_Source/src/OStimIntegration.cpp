@@ -101,4 +101,33 @@ namespace OStimNavigator {
         }
         return actor;
     }
+
+    std::vector<RE::Actor*> OStimIntegration::GetActorsFromThread(uint32_t threadID) const
+    {
+        std::vector<RE::Actor*> result;
+        if (!m_threadInterface) {
+            SKSE::log::warn("OStimIntegration::GetActorsFromThread: Thread interface not available.");
+            return result;
+        }
+
+        uint32_t count = m_threadInterface->GetActorCount(threadID);
+        std::vector<OstimNG_API::Thread::ActorData> buffer(count);
+        uint32_t filled = count > 0 ? m_threadInterface->GetActors(threadID, buffer.data(), count) : 0;
+
+        result.resize(count, nullptr);
+        for (uint32_t i = 0; i < filled && i < count; ++i) {
+            if (!buffer[i].formID) {
+                continue;
+            }
+            if (auto* form = RE::TESForm::LookupByID(buffer[i].formID)) {
+                result[i] = form->As<RE::Actor>();
+            }
+            if (!result[i]) {
+                SKSE::log::warn("OStimIntegration::GetActorsFromThread: Form 0x{:X} in slot {} is not an Actor.", buffer[i].formID, i);
+            }
+        }
+
+        SKSE::log::debug("OStimIntegration::GetActorsFromThread: Resolved {}/{} actors from thread {}.", filled, count, threadID);
+        return result;
+    }
 }
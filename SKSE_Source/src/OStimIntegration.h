@@ -34,6 +34,10 @@ namespace OStimNavigator {
         // Returns nullptr if unavailable.
         RE::Actor* GetActorFromThread(uint32_t threadID, uint32_t actorIndex) const;
 
+        // Every actor in a thread with a single API call, in slot order.
+        // Slots that cannot be resolved hold nullptr.
+        std::vector<RE::Actor*> GetActorsFromThread(uint32_t threadID) const;
+
     private:
         OStimIntegration() = default;
         OStimIntegration(const OStimIntegration&) = delete;
@@ -326,6 +326,43 @@ inline bool (*ONavSceneHasFurniture)(const char* sceneId) = nullptr;
 inline int (*ONavGetScenePhaseRank)(const char* sceneId) = nullptr;
 #endif
 
+/**
+ * Search scenes by name, ID, modpack or scene tag, tolerating typos.
+ *
+ * Matching ignores case. Queries of 5-8 characters may be one edit away from the
+ * text and longer ones two; shorter queries must match exactly. Exact matches rank
+ * above fuzzy ones, and name matches above ID, modpack and tag matches.
+ *
+ * @param query       Search text. Must not be null.
+ * @param maxResults  Maximum number of results, or 0 for all of them.
+ *
+ * @return A pointer to a null-terminated JSON string inside OStimNavigator.dll's
+ *         internal static buffer. COPY IT IMMEDIATELY — it is overwritten on
+ *         the next call.
+ *         Format: [{"id":"SomeModpack|SomeScene","score":0.950000}, ...]
+ *         (best match first; score is 0 to 1)
+ *         Returns "[]" (never null) for an empty query or when nothing matches.
+ *
+ * @note Not thread-safe. Call only from the SKSE game thread.
+ */
+#ifndef OSTIMNAVIGATOR_BUILDING
+inline const char* (*ONavSearchScenes)(const char* query, uint32_t maxResults) = nullptr;
+#endif
+
+/**
+ * Return the load state of OStimNavigator's scene catalog.
+ *
+ * The catalog is built in the background after kDataLoaded, so it may still be
+ * loading when you first resolve the functions. Until this returns "ready", the
+ * scene-based functions above return their empty/unknown value ("", "[]", false, -1).
+ * Listen for OStimNavigatorAPI::kMessageCatalogReady to be told when it is done.
+ *
+ * @return "loading", "ready", "failed" or "not loaded". Static string, never null.
+ */
+#ifndef OSTIMNAVIGATOR_BUILDING
+inline const char* (*ONavGetCatalogState)() = nullptr;
+#endif
+
 // =============================================================================
 // Initialization
 // =============================================================================
@@ -333,8 +370,9 @@ inline int (*ONavGetScenePhaseRank)(const char* sceneId) = nullptr;
 /**
  * Load OStimNavigator.dll and resolve all exported function pointers.
  *
- * Call once during plugin initialization (kDataLoaded is recommended so the
- * scene database is already populated when you make your first call).
+ * Call once during plugin initialization (kDataLoaded is recommended). The scene
+ * catalog may still be loading at that point — check ONavGetCatalogState() or
+ * wait for OStimNavigatorAPI::kMessageCatalogReady before relying on results.
  *
  * @return true if OStimNavigator.dll was found and ONavBuildSceneDescription resolved.
  *         Returns false (gracefully) when the mod is not installed.
@@ -395,6 +433,12 @@ inline bool ONavFindFunctions() {
     ONavGetScenePhaseRank = reinterpret_cast<int(*)(const char*)>(
         GetProcAddress(hDLL, "ONavGetScenePhaseRank"));
 
+    ONavSearchScenes = reinterpret_cast<const char*(*)(const char*, uint32_t)>(
+        GetProcAddress(hDLL, "ONavSearchScenes"));
+
+    ONavGetCatalogState = reinterpret_cast<const char*(*)()>(
+        GetProcAddress(hDLL, "ONavGetCatalogState"));
+
     return ONavBuildSceneDescription != nullptr;
 }
 #endif
@@ -407,6 +451,14 @@ inline bool ONavFindFunctions() {
 
 namespace OStimNavigatorAPI {
 
+// ─── SKSE messages ──
+// Dispatched to every plugin that called
+// SKSE::GetMessagingInterface()->RegisterListener("OStimNavigator", ...).
+// Both carry no data and arrive on the game thread.
+
+inline constexpr uint32_t kMessageCatalogReady  = 0x4F4E5201;  // Scene catalog finished loading
+inline constexpr uint32_t kMessageCatalogFailed = 0x4F4E5202;  // Scene catalog failed to load
+
 
 
 
@@ -1,5 +1,6 @@
 #include "OStimNetIntegration.h"
 #include "OStimIntegration.h"
+#include "DirectoryListing.h"
 #include "JsonUtils.h"
 #include "SceneDatabase.h"
 #include "OStimNetMetaData.h"
@@ -37,7 +38,7 @@ namespace OStimNavigator {
         static int s_descriptionFilter = 0;
 
         // Filtered results
-        static std::vector<SceneData*> s_filteredScenes;
+        static std::vector<SceneHandle> s_filteredScenes;
         static int s_currentPage = 0;
         static int s_itemsPerPage = 50;
 
@@ -77,18 +78,16 @@ namespace OStimNavigator {
 
             SKSE::log::info("Loading OStimNet animation descriptions from: {}", descriptionsPath.string());
 
+            JsonUtils::ReadStats stats;
             JsonUtils::LoadJsonFilesFromDirectory(descriptionsPath,
-                [](const std::filesystem::path& filePath) {
+                [&stats](const std::filesystem::path& filePath) {
                     try {
-                        std::ifstream file(filePath);
-                        if (!file.is_open()) {
+                        nlohmann::json j;
+                        if (!JsonUtils::ParseFile(filePath, j, &stats)) {
                             SKSE::log::warn("Failed to open description file: {}", filePath.string());
                             return;
                         }
 
-                        nlohmann::json j;
-                        file >> j;
-
                         // Iterate through all animation IDs in the JSON file
                         // Format: { "AnimID": "description text", ... }
                         for (auto& [animId, animData] : j.items()) {
@@ -114,6 +113,7 @@ namespace OStimNavigator {
                     }
                 });
 
+            stats.Log("OStimNetIntegration (descriptions)");
             SKSE::log::info("Loaded {} animation descriptions", s_animationDescriptions.size());
             s_descriptionsLoaded = true;
         }
@@ -146,11 +146,7 @@ namespace OStimNavigator {
             nlohmann::json descriptions;
             if (std::filesystem::exists(targetFile)) {
                 try {
-                    std::ifstream file(targetFile, std::ios::binary);
-                    if (file.is_open()) {
-                        file >> descriptions;
-                        file.close();
-                    }
+                    JsonUtils::ParseFile(targetFile, descriptions);
                 } catch (const std::exception& e) {
                     SKSE::log::warn("Failed to load descriptions file {}: {}", targetFile.string(), e.what());
                 }
@@ -212,10 +208,8 @@ namespace OStimNavigator {
             }
 
             try {
-                for (const auto& entry : std::filesystem::directory_iterator(descriptionsPath)) {
-                    if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                        files.push_back(entry.path().filename().string());
-                    }
+                for (const auto& file : DirectoryListing::ListJsonFiles(descriptionsPath, false)) {
+                    files.push_back(file.path.filename().string());
                 }
             } catch (const std::exception& e) {
                 SKSE::log::error("Failed to list description files: {}", e.what());
@@ -230,43 +224,46 @@ namespace OStimNavigator {
             auto& sceneDB = SceneDatabase::GetSingleton();
             auto& actionDB = ActionDatabase::GetSingleton();
 
-            if (!sceneDB.IsLoaded()) {
+            if (!sceneDB.IsReady()) {
                 s_filteredScenes.clear();
                 return;
             }
 
-            // Get all scenes
-            auto allScenes = sceneDB.GetAllScenes();
+            const SceneColumns& columns = sceneDB.GetColumns();
+            const SceneSearchIndex& searchIndex = sceneDB.GetSearchIndex();
             s_filteredScenes.clear();
 
-            for (auto* scene : allScenes) {
-                if (!scene) continue;
+            // Search filter, resolved once through the trigram index
+            const bool hasSearch = s_searchBuffer[0] != '\0';
+            const PostingList searchHits = hasSearch ? searchIndex.Search(s_searchBuffer) : PostingList();
+
+            // Selections as symbols, so the per-scene checks compare ids
+            const auto modpacks = InternAll(s_selectedModpacks);
+            const auto furniture = InternAll(s_selectedFurniture);
+            const auto sceneTags = InternAll(s_selectedSceneTags);
+            const auto actorTags = InternAll(s_selectedActorTags);
+            const auto actions = InternAll(s_selectedActions);
+            const auto actionTags = InternAll(s_selectedActionTags);
+            auto contains = [](const std::vector<Symbol>& symbols, Symbol symbol) {
+                return std::find(symbols.begin(), symbols.end(), symbol) != symbols.end();
+            };
+
+            for (uint32_t index = 0; index < columns.Size(); ++index) {
+                SceneData* scene = columns.scenes[index];
 
                 // Filter out swapped scenes (actor position variants that reuse animations)
                 // Case-insensitive check for "swapped" anywhere in the scene ID
-                std::string sceneIdLower = scene->id;
-                StringUtils::ToLower(sceneIdLower);
-                if (sceneIdLower.find("swapped") != std::string::npos) {
+                if (searchIndex.LowerId(index).find("swapped") != std::string::npos) {
                     continue;
                 }
 
                 // Apply search filter
-                if (s_searchBuffer[0] != '\0') {
-                    std::string searchLower = s_searchBuffer;
-                    StringUtils::ToLower(searchLower);
-                    std::string sceneIDLower = scene->id;
-                    std::string sceneNameLower = scene->name;
-                    StringUtils::ToLower(sceneIDLower);
-                    StringUtils::ToLower(sceneNameLower);
-
-                    if (sceneIDLower.find(searchLower) == std::string::npos &&
-                        sceneNameLower.find(searchLower) == std::string::npos) {
-                        continue;
-                    }
+                if (hasSearch && !std::binary_search(searchHits.begin(), searchHits.end(), index)) {
+                    continue;
                 }
 
                 // Apply modpack filter
-                if (!s_selectedModpacks.empty() && s_selectedModpacks.find(scene->modpack) == s_selectedModpacks.end()) {
+                if (!s_selectedModpacks.empty() && !contains(modpacks, scene->modpack)) {
                     continue;
                 }
 
@@ -274,12 +271,12 @@ namespace OStimNavigator {
                 if (!s_selectedFurniture.empty()) {
                     if (scene->furnitureType.empty()) {
                         // Scene has no furniture requirement, check if "None" is selected
-                        if (s_selectedFurniture.find("") == s_selectedFurniture.end()) {
+                        if (!contains(furniture, Symbol())) {
                             continue;
                         }
                     } else {
                         // Scene has furniture requirement
-                        if (s_selectedFurniture.find(scene->furnitureType) == s_selectedFurniture.end()) {
+                        if (!contains(furniture, scene->furnitureType)) {
                             continue;
                         }
                     }
@@ -289,13 +286,13 @@ namespace OStimNavigator {
                 if (!s_selectedSceneTags.empty()) {
                     bool match = false;
                     if (s_sceneTagsAND) {
-                        match = std::all_of(s_selectedSceneTags.begin(), s_selectedSceneTags.end(),
-                            [&scene](const std::string& tag) {
+                        match = std::all_of(sceneTags.begin(), sceneTags.end(),
+                            [&scene](Symbol tag) {
                                 return std::find(scene->tags.begin(), scene->tags.end(), tag) != scene->tags.end();
                             });
                     } else {
-                        match = std::any_of(s_selectedSceneTags.begin(), s_selectedSceneTags.end(),
-                            [&scene](const std::string& tag) {
+                        match = std::any_of(sceneTags.begin(), sceneTags.end(),
+                            [&scene](Symbol tag) {
                                 return std::find(scene->tags.begin(), scene->tags.end(), tag) != scene->tags.end();
                             });
                     }
@@ -307,8 +304,8 @@ namespace OStimNavigator {
                     bool match = false;
                     for (const auto& actor : scene->actors) {
                         if (s_actorTagsAND) {
-                            bool actorMatch = std::all_of(s_selectedActorTags.begin(), s_selectedActorTags.end(),
-                                [&actor](const std::string& tag) {
+                            bool actorMatch = std::all_of(actorTags.begin(), actorTags.end(),
+                                [&actor](Symbol tag) {
                                     return std::find(actor.tags.begin(), actor.tags.end(), tag) != actor.tags.end();
                                 });
                             if (actorMatch) {
@@ -316,8 +313,8 @@ namespace OStimNavigator {
                                 break;
                             }
                         } else {
-                            bool actorMatch = std::any_of(s_selectedActorTags.begin(), s_selectedActorTags.end(),
-                                [&actor](const std::string& tag) {
+                            bool actorMatch = std::any_of(actorTags.begin(), actorTags.end(),
+                                [&actor](Symbol tag) {
                                     return std::find(actor.tags.begin(), actor.tags.end(), tag) != actor.tags.end();
                                 });
                             if (actorMatch) {
@@ -333,16 +330,16 @@ namespace OStimNavigator {
                 if (!s_selectedActions.empty()) {
                     bool match = false;
                     if (s_actionsAND) {
-                        match = std::all_of(s_selectedActions.begin(), s_selectedActions.end(),
-                            [&scene](const std::string& action) {
+                        match = std::all_of(actions.begin(), actions.end(),
+                            [&scene](Symbol action) {
                                 return std::find_if(scene->actions.begin(), scene->actions.end(),
-                                    [&action](const SceneActionData& a) { return a.type == action; }) != scene->actions.end();
+                                    [action](const SceneActionData& a) { return a.type == action; }) != scene->actions.end();
                             });
                     } else {
-                        match = std::any_of(s_selectedActions.begin(), s_selectedActions.end(),
-                            [&scene](const std::string& action) {
+                        match = std::any_of(actions.begin(), actions.end(),
+                            [&scene](Symbol action) {
                                 return std::find_if(scene->actions.begin(), scene->actions.end(),
-                                    [&action](const SceneActionData& a) { return a.type == action; }) != scene->actions.end();
+                                    [action](const SceneActionData& a) { return a.type == action; }) != scene->actions.end();
                             });
                     }
                     if (!match) continue;
@@ -356,8 +353,8 @@ namespace OStimNavigator {
                         if (!actionData) continue;
 
                         if (s_actionTagsAND) {
-                            bool actionMatch = std::all_of(s_selectedActionTags.begin(), s_selectedActionTags.end(),
-                                [&actionData](const std::string& tag) {
+                            bool actionMatch = std::all_of(actionTags.begin(), actionTags.end(),
+                                [&actionData](Symbol tag) {
                                     return std::find(actionData->tags.begin(), actionData->tags.end(), tag) != actionData->tags.end();
                                 });
                             if (actionMatch) {
@@ -365,8 +362,8 @@ namespace OStimNavigator {
                                 break;
                             }
                         } else {
-                            bool actionMatch = std::any_of(s_selectedActionTags.begin(), s_selectedActionTags.end(),
-                                [&actionData](const std::string& tag) {
+                            bool actionMatch = std::any_of(actionTags.begin(), actionTags.end(),
+                                [&actionData](Symbol tag) {
                                     return std::find(actionData->tags.begin(), actionData->tags.end(), tag) != actionData->tags.end();
                                 });
                             if (actionMatch) {
@@ -391,13 +388,13 @@ namespace OStimNavigator {
                 }
 
                 // Scene passed all filters
-                s_filteredScenes.push_back(scene);
+                s_filteredScenes.push_back(scene->handle);
             }
 
             // Sort filtered scenes alphabetically by scene ID (case-insensitive)
             std::sort(s_filteredScenes.begin(), s_filteredScenes.end(),
-                [](const SceneData* a, const SceneData* b) {
-                    return _stricmp(a->id.c_str(), b->id.c_str()) < 0;
+                [&sceneDB](SceneHandle a, SceneHandle b) {
+                    return _stricmp(sceneDB.Resolve(a)->id.c_str(), sceneDB.Resolve(b)->id.c_str()) < 0;
                 });
 
             s_currentPage = 0;
@@ -440,8 +437,8 @@ namespace OStimNavigator {
             ImGuiMCP::ImGui::TableSetColumnIndex(5);
             std::unordered_set<std::string> uniqueActorTags;
             for (const auto& actor : scene->actors) {
-                for (const auto& tag : actor.tags) {
-                    uniqueActorTags.insert(tag);
+                for (Symbol tag : actor.tags) {
+                    uniqueActorTags.insert(tag.str());
                 }
             }
             RenderPillCollection(uniqueActorTags, s_emptyHighlightSet,
@@ -454,7 +451,7 @@ namespace OStimNavigator {
             // Scene Tags (as pills)
             ImGuiMCP::ImGui::TableSetColumnIndex(6);
             RenderPillCollection(scene->tags, s_emptyHighlightSet,
-                [](const std::string& tag) -> const std::string& { return tag; },
+                [](Symbol tag) -> const std::string& { return tag.str(); },
                 &s_selectedSceneTags, nullptr, false,
                 []() {
                     ApplyFilters();
@@ -499,13 +496,13 @@ namespace OStimNavigator {
                 if (hasDescription) {
                     strncpy_s(s_editorDescriptionBuffer, descText.c_str(), sizeof(s_editorDescriptionBuffer) - 1);
                     if (isInherited) {
-                        s_editorSelectedFile = scene->modpack + ".json";
+                        s_editorSelectedFile = scene->modpack.str() + ".json";
                     } else {
                         s_editorSelectedFile = descFile;
                     }
                 } else {
                     s_editorDescriptionBuffer[0] = '\0';
-                    s_editorSelectedFile = scene->modpack + ".json";
+                    s_editorSelectedFile = scene->modpack.str() + ".json";
                 }
             }
 
@@ -522,6 +519,17 @@ namespace OStimNavigator {
                 return;
             }
 
+            switch (SceneDatabase::GetSingleton().GetLoadState()) {
+                case SceneDatabase::LoadState::Ready:
+                    break;
+                case SceneDatabase::LoadState::Failed:
+                    ImGuiMCP::ImGui::TextColored(s_orangeTextColor, "Scene catalog failed to load, see OstimNavigator.log");
+                    return;
+                default:
+                    ImGuiMCP::ImGui::TextColored(s_orangeTextColor, "Scene catalog is loading...");
+                    return;
+            }
+
             // Load descriptions on first render
             if (!s_descriptionsLoaded) {
                 LoadAnimationDescriptions();
@@ -577,12 +585,12 @@ namespace OStimNavigator {
                 ImGuiMCP::ImGui::SetNextItemWidth(-10.0f);
                 ImGuiMCP::ImGui::PushStyleColor(ImGuiMCP::ImGuiCol_PopupBg, ImGuiMCP::ImVec4(0.12f, 0.12f, 0.14f, 1.0f));
                 if (ImGuiMCP::ImGui::BeginCombo("##modpack_combo", modpackPreview.c_str())) {
-                    if (sceneDB.IsLoaded()) {
+                    if (sceneDB.IsReady()) {
                         std::unordered_set<std::string> allModpacks;
                         auto allScenes = sceneDB.GetAllScenes();
                         for (auto* scene : allScenes) {
                             if (scene && !scene->modpack.empty()) {
-                                allModpacks.insert(scene->modpack);
+                                allModpacks.insert(scene->modpack.str());
                             }
                         }
 
@@ -676,7 +684,7 @@ namespace OStimNavigator {
                 ImGuiMCP::ImGui::Spacing();
 
                 // Scene Tags, Actor Tags, Actions, and Action Tags filters
-                if (sceneDB.IsLoaded()) {
+                if (sceneDB.IsReady()) {
                     static char tagSearchBuffer[128] = "";
                     static char actorTagSearchBuffer[128] = "";
                     static char actionSearchBuffer[128] = "";
@@ -797,7 +805,13 @@ namespace OStimNavigator {
                                 const auto& spec = sortSpecs->Specs[0];
 
                                 std::sort(s_filteredScenes.begin(), s_filteredScenes.end(),
-                                    [&spec](const SceneData* a, const SceneData* b) {
+                                    [&spec](SceneHandle handleA, SceneHandle handleB) {
+                                        auto& sceneDB = SceneDatabase::GetSingleton();
+                                        const SceneData* a = sceneDB.Resolve(handleA);
+                                        const SceneData* b = sceneDB.Resolve(handleB);
+                                        if (!a || !b) {
+                                            return a && !b;  // Stale handles sink to the end
+                                        }
                                         int delta = 0;
 
                                         switch (spec.ColumnIndex) {
@@ -833,7 +847,7 @@ namespace OStimNavigator {
                     int endIdx = std::min(startIdx + s_itemsPerPage, (int)s_filteredScenes.size());
 
                     for (int i = startIdx; i < endIdx; ++i) {
-                        SceneData* scene = s_filteredScenes[i];
+                        SceneData* scene = SceneDatabase::GetSingleton().Resolve(s_filteredScenes[i]);
                         if (!scene) continue;
 
                         ImGuiMCP::ImGui::TableNextRow();
@@ -902,7 +916,7 @@ namespace OStimNavigator {
                         ImGuiMCP::ImGui::SameLine();
                         if (!s_editorScene->actors[i].tags.empty()) {
                             for (size_t j = 0; j < s_editorScene->actors[i].tags.size(); ++j) {
-                                ImGuiMCP::ImVec4 color = GetColorForTag(s_editorScene->actors[i].tags[j], true);
+                                ImGuiMCP::ImVec4 color = GetColorForTag(s_editorScene->actors[i].tags[j].str(), true);
                                 RenderPill(s_editorScene->actors[i].tags[j].c_str(), color, false);
                                 if (j < s_editorScene->actors[i].tags.size() - 1) {
                                     ImGuiMCP::ImGui::SameLine();
@@ -929,7 +943,7 @@ namespace OStimNavigator {
                         ImGuiMCP::ImGui::Text("Scene Tags:");
                         ImGuiMCP::ImGui::SameLine();
                         RenderPillCollection(s_editorScene->tags, s_emptyHighlightSet,
-                            [](const std::string& tag) -> const std::string& { return tag; },
+                            [](Symbol tag) -> const std::string& { return tag.str(); },
                             nullptr, nullptr, false, nullptr);
                     }
 
@@ -962,7 +976,7 @@ namespace OStimNavigator {
                         auto descFiles = GetDescriptionFiles();
 
                         // Add default modpack file if not in list
-                        std::string defaultFile = s_editorScene->modpack + ".json";
+                        std::string defaultFile = s_editorScene->modpack.str() + ".json";
                         if (std::find(descFiles.begin(), descFiles.end(), defaultFile) == descFiles.end()) {
                             descFiles.insert(descFiles.begin(), defaultFile);
                         }
@@ -1040,7 +1054,7 @@ namespace OStimNavigator {
                         if (sceneID) {
                             auto* scene = SceneDatabase::GetSingleton().GetSceneByID(sceneID);
                             if (scene && !scene->furnitureType.empty()) {
-                                s_selectedFurniture.insert(scene->furnitureType);
+                                s_selectedFurniture.insert(scene->furnitureType.str());
                             }
                         }
                     }
@@ -13,7 +13,8 @@ namespace OStimNavigator {
     // ─── canonical positions list ─────────────────────────────────────────────
 
     /*static*/ const std::vector<std::string>& OStimNetMetaData::GetPositionSuggestions() {
-        return kPositions;
+        static const std::vector<std::string> positions(kPositions.begin(), kPositions.end());
+        return positions;
     }
 
     // ─────────────────────────────────────────────────────────────────────────
@@ -27,27 +28,26 @@ namespace OStimNavigator {
 
         std::filesystem::path descriptionsPath = "Data/SKSE/Plugins/OStimNet/animationsDescriptions";
 
+        JsonUtils::ReadStats stats;
         JsonUtils::LoadJsonFilesFromDirectory(descriptionsPath,
-            [this](const std::filesystem::path& path) {
-                ParseDescriptionFile(path);
+            [this, &stats](const std::filesystem::path& path) {
+                ParseDescriptionFile(path, stats);
             },
             false);  // non-recursive
+        stats.Log("OStimNetMetaData (descriptions)");
 
         SKSE::log::info("Loaded {} animation descriptions", m_descriptions.size());
         m_loaded = true;
     }
 
-    void OStimNetMetaData::ParseDescriptionFile(const std::filesystem::path& filePath) {
+    void OStimNetMetaData::ParseDescriptionFile(const std::filesystem::path& filePath, JsonUtils::ReadStats& stats) {
         try {
-            std::ifstream file(filePath);
-            if (!file.is_open()) {
+            nlohmann::json j;
+            if (!JsonUtils::ParseFile(filePath, j, &stats)) {
                 SKSE::log::warn("Failed to open animation description file: {}", filePath.string());
                 return;
             }
 
-            nlohmann::json j;
-            file >> j;
-
             if (!j.is_object()) {
                 SKSE::log::warn("Animation description file is not a JSON object: {}", filePath.string());
                 return;
@@ -83,10 +83,7 @@ namespace OStimNavigator {
     }
 
     const AnimationDescriptionEntry* OStimNetMetaData::GetDescription(const std::string& sceneId) const {
-        std::string id = sceneId;
-        StringUtils::ToLower(id);
-
-        auto it = m_descriptions.find(id);
+        auto it = m_descriptions.find(sceneId);
         if (it == m_descriptions.end()) {
             return nullptr;
         }
@@ -99,9 +96,7 @@ namespace OStimNavigator {
             return nullptr;
         }
 
-        std::string idLower = sceneId;
-        StringUtils::ToLower(idLower);
-        if (m_descriptions.contains(idLower)) {
+        if (m_descriptions.contains(sceneId)) {
             return nullptr;
         }
 
@@ -143,14 +138,10 @@ namespace OStimNavigator {
 
             nlohmann::json j = nlohmann::json::object();
             if (std::filesystem::exists(filePath)) {
-                std::ifstream in(filePath, std::ios::binary);
-                if (in.is_open()) {
-                    try {
-                        in >> j;
-                        if (!j.is_object()) j = nlohmann::json::object();
-                    } catch (...) {
-                        j = nlohmann::json::object();
-                    }
+                try {
+                    if (!JsonUtils::ParseFile(filePath, j) || !j.is_object()) j = nlohmann::json::object();
+                } catch (...) {
+                    j = nlohmann::json::object();
                 }
             }
 
@@ -183,7 +174,7 @@ namespace OStimNavigator {
 
         // New entry: resolve the target file from the scene's modpack name.
         const SceneData* scene = SceneDatabase::GetSingleton().GetSceneByID(id);
-        std::string modpack = (scene && !scene->modpack.empty()) ? scene->modpack : "unknown";
+        std::string modpack = (scene && !scene->modpack.empty()) ? scene->modpack.str() : "unknown";
 
         std::filesystem::path filePath =
             std::filesystem::path("Data/SKSE/Plugins/OStimNet/animationsDescriptions") / (modpack + ".json");
@@ -191,16 +182,12 @@ namespace OStimNavigator {
         // Load any existing content from that file so we don't overwrite other entries.
         nlohmann::json j = nlohmann::json::object();
         if (std::filesystem::exists(filePath)) {
-            std::ifstream in(filePath, std::ios::binary);
-            if (in.is_open()) {
-                try {
-                    in >> j;
-                    if (!j.is_object()) {
-                        j = nlohmann::json::object();
-                    }
-                } catch (...) {
+            try {
+                if (!JsonUtils::ParseFile(filePath, j) || !j.is_object()) {
                     j = nlohmann::json::object();
                 }
+            } catch (...) {
+                j = nlohmann::json::object();
             }
         }
 
@@ -262,15 +249,13 @@ namespace OStimNavigator {
         }
 
         try {
-            std::ifstream file(filePath, std::ios::binary);
-            if (!file.is_open()) {
+            JsonUtils::ReadStats stats;
+            nlohmann::json j;
+            if (!JsonUtils::ParseFile(filePath, j, &stats)) {
                 SKSE::log::warn("OStimNetMetaData: failed to open {}", filePath.string());
                 return;
             }
 
-            nlohmann::json j;
-            file >> j;
-
             if (!j.is_object()) {
                 SKSE::log::warn("OStimNetMetaData: {} is not a JSON object", filePath.string());
                 return;
@@ -293,6 +278,7 @@ namespace OStimNavigator {
             }
 
             SKSE::log::info("OStimNetMetaData: loaded {} scene meta entries", m_sceneMeta.size());
+            stats.Log("OStimNetMetaData (scene meta)");
 
         } catch (const std::exception& e) {
             SKSE::log::error("OStimNetMetaData: error reading {}: {}", filePath.string(), e.what());
@@ -300,10 +286,7 @@ namespace OStimNavigator {
     }
 
     const SceneMeta* OStimNetMetaData::GetSceneMeta(const std::string& sceneId) const {
-        std::string id = sceneId;
-        StringUtils::ToLower(id);
-
-        auto it = m_sceneMeta.find(id);
+        auto it = m_sceneMeta.find(sceneId);
         if (it == m_sceneMeta.end()) return nullptr;
         return &it->second;
     }
@@ -317,14 +300,10 @@ namespace OStimNavigator {
         // Load existing file content so we don't overwrite other entries.
         nlohmann::json j = nlohmann::json::object();
         if (std::filesystem::exists(filePath)) {
-            std::ifstream in(filePath, std::ios::binary);
-            if (in.is_open()) {
-                try {
-                    in >> j;
-                    if (!j.is_object()) j = nlohmann::json::object();
-                } catch (...) {
-                    j = nlohmann::json::object();
-                }
+            try {
+                if (!JsonUtils::ParseFile(filePath, j) || !j.is_object()) j = nlohmann::json::object();
+            } catch (...) {
+                j = nlohmann::json::object();
             }
         }
 
@@ -368,7 +347,7 @@ namespace OStimNavigator {
             if (positionsSet.count(tagLower)) return tagLower;
             // Alias match.
             auto it = kPositionAliases.find(tagLower);
-            if (it != kPositionAliases.end()) return it->second;
+            if (it != kPositionAliases.end()) return std::string(it->second);
             return {};
         };
 
@@ -388,8 +367,8 @@ namespace OStimNavigator {
             // Collect matched positions in canonical form, deduped, order preserved.
             std::vector<std::string> matched;
             std::unordered_set<std::string> seen;
-            for (const auto& tag : scene->tags) {
-                std::string tagLower = tag;
+            for (Symbol tag : scene->tags) {
+                std::string tagLower = tag.str();
                 StringUtils::ToLower(tagLower);
                 std::string canonical = resolveTag(tagLower);
                 if (!canonical.empty() && seen.insert(canonical).second) {
@@ -432,7 +411,7 @@ namespace OStimNavigator {
             originalKey = it->second.originalKey;
         } else {
             const SceneData* scene = SceneDatabase::GetSingleton().GetSceneByID(id);
-            std::string modpack = (scene && !scene->modpack.empty()) ? scene->modpack : "unknown";
+            std::string modpack = (scene && !scene->modpack.empty()) ? scene->modpack.str() : "unknown";
             filePath    = std::filesystem::path("Data/SKSE/Plugins/OStimNet/animationsDescriptions") /
                           (modpack + ".json");
             originalKey = sceneId;  // preserve original casing supplied by the caller
@@ -442,11 +421,8 @@ namespace OStimNavigator {
         std::thread([this, id, sceneId, description, filePath, originalKey, onComplete]() {
             nlohmann::json j = nlohmann::json::object();
             if (std::filesystem::exists(filePath)) {
-                std::ifstream in(filePath, std::ios::binary);
-                if (in.is_open()) {
-                    try { in >> j; if (!j.is_object()) j = nlohmann::json::object(); }
-                    catch (...) { j = nlohmann::json::object(); }
-                }
+                try { if (!JsonUtils::ParseFile(filePath, j) || !j.is_object()) j = nlohmann::json::object(); }
+                catch (...) { j = nlohmann::json::object(); }
             }
 
             j[originalKey] = description;
@@ -505,11 +481,8 @@ namespace OStimNavigator {
         std::thread([this, id, sceneId, meta, filePath, onComplete]() {
             nlohmann::json j = nlohmann::json::object();
             if (std::filesystem::exists(filePath)) {
-                std::ifstream in(filePath, std::ios::binary);
-                if (in.is_open()) {
-                    try { in >> j; if (!j.is_object()) j = nlohmann::json::object(); }
-                    catch (...) { j = nlohmann::json::object(); }
-                }
+                try { if (!JsonUtils::ParseFile(filePath, j) || !j.is_object()) j = nlohmann::json::object(); }
+                catch (...) { j = nlohmann::json::object(); }
             }
 
             j[id]["intent"]    = meta.intent;
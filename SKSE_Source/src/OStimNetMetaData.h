@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PCH.h"
+#include "StringUtils.h"
 #include <filesystem>
 #include <functional>
 #include <string>
@@ -8,6 +9,7 @@
 #include <vector>
 
 namespace OStimNavigator {
+    namespace JsonUtils { struct ReadStats; }
 
     struct AnimationDescriptionEntry {
         std::string description;
@@ -53,6 +55,9 @@ namespace OStimNavigator {
         // Load scene meta entries from Data/SKSE/Plugins/OStimNet/OStimNetMetaData.json
         void LoadSceneMeta();
 
+        // Path of the scene meta file (relative to the game directory)
+        static const char* GetMetaFilePath() { return k_metaFilePath; }
+
         // Returns null if the scene ID has no meta entry
         const SceneMeta* GetSceneMeta(const std::string& sceneId) const;
 
@@ -88,13 +93,14 @@ namespace OStimNavigator {
         OStimNetMetaData(const OStimNetMetaData&) = delete;
         OStimNetMetaData& operator=(const OStimNetMetaData&) = delete;
 
-        void ParseDescriptionFile(const std::filesystem::path& filePath);
+        void ParseDescriptionFile(const std::filesystem::path& filePath, JsonUtils::ReadStats& stats);
 
         static constexpr const char* k_metaFilePath =
             "Data/SKSE/Plugins/OStimNet/OStimNetMetaData.json";
 
-        std::unordered_map<std::string, AnimationDescriptionEntry> m_descriptions;
-        std::unordered_map<std::string, SceneMeta> m_sceneMeta;
+        // Keyed by lowercase scene ID; lookups ignore case without copying the ID
+        StringUtils::CaseInsensitiveMap<AnimationDescriptionEntry> m_descriptions;
+        StringUtils::CaseInsensitiveMap<SceneMeta> m_sceneMeta;
         bool m_loaded = false;
     };
 
@@ -17,7 +17,11 @@ namespace OStimNavigator {
         bool IsSceneLoaded(RE::BSScript::IVirtualMachine*, RE::VMStackID, RE::StaticFunctionTag*,
                            RE::BSFixedString asSceneID) {
             SKSE::log::info("Papyrus::IsSceneLoaded called with sceneID='{}'", asSceneID.c_str());
-            return SceneDatabase::GetSingleton().GetSceneByID(asSceneID.c_str()) != nullptr;
+            auto& sceneDB = SceneDatabase::GetSingleton();
+            if (!sceneDB.IsReady()) {
+                return false;
+            }
+            return sceneDB.GetSceneByID(asSceneID.c_str()) != nullptr;
         }
 
         bool Register(RE::BSScript::IVirtualMachine* vm) {
@@ -1,11 +1,13 @@
 #include "PrismaUIManager.h"
 #include "KeyboardInputBlocker.h"
+#include "JsonUtils.h"
 #include "Settings.h"
 #include "ActionDatabase.h"
 #include "OStimNetMetaData.h"
 #include "OStimIntegration.h"
 #include "SceneDescriptionBuilder.h"
 #include "SceneDescriptionData.h"
+#include "SceneTagWriter.h"
 #include "SkyrimNetIntegration.h"
 #include <nlohmann/json.hpp>
 #include <algorithm>
@@ -43,7 +45,7 @@ namespace OStimNavigator {
 
     static nlohmann::json SerializeScenes() {
         auto& db = SceneDatabase::GetSingleton();
-        if (!db.IsLoaded()) return nlohmann::json::array();
+        if (!db.IsReady()) return nlohmann::json::array();
 
         std::vector<nlohmann::json> entries;
         entries.reserve(db.GetSceneCount());
@@ -255,6 +257,17 @@ namespace OStimNavigator {
             return;
         }
 
+        // The view pulls the full scene list on creation, so wait for the catalog
+        const auto loadState = SceneDatabase::GetSingleton().GetLoadState();
+        if (loadState != SceneDatabase::LoadState::Ready) {
+            SKSE::log::info("PrismaUIManager: scene catalog is {}, not opening the navigator",
+                SceneDatabase::LoadStateName(loadState));
+            RE::DebugNotification(loadState == SceneDatabase::LoadState::Failed
+                ? "OStim Navigator: scene catalog failed to load, see OstimNavigator.log"
+                : "OStim Navigator: scene catalog is still loading");
+            return;
+        }
+
         if (view && prismaUI->IsValid(view)) {
             prismaUI->Show(view);
             if(!prismaUI->HasFocus(view)) {
@@ -433,7 +446,7 @@ namespace OStimNavigator {
             if (!sceneID.empty()) {
                 auto* sceneData = SceneDatabase::GetSingleton().GetSceneByID(sceneID);
                 if (sceneData) {
-                    furnitureType = sceneData->furnitureType;
+                    furnitureType = sceneData->furnitureType.str();
                 }
             }
 
@@ -507,6 +520,9 @@ namespace OStimNavigator {
             // Validate the JSON and write to disk on a background thread so the
             // game loop is not blocked by I/O or JSON parsing.
             std::thread([sceneId, content, filePath]() {
+                // A queued metadata tag write must not land on top of the user's save
+                SceneTagWriter::Flush(filePath);
+
                 // Validate that the content is well-formed JSON before writing.
                 try {
                     (void)nlohmann::json::parse(content);
@@ -675,11 +691,11 @@ namespace OStimNavigator {
                 ctx["furnitureType"]= scene->furnitureType;
 
                 std::vector<std::string> actionTypes;
-                for (const auto& ac : scene->actions) actionTypes.push_back(ac.type);
+                for (const auto& ac : scene->actions) actionTypes.push_back(ac.type.str());
                 ctx["actions"] = actionTypes;
 
                 // autoDescription — build programmatically
-                ctx["autoDescription"] = BuildSceneDescription(*scene, 0);
+                ctx["autoDescription"] = BuildSceneDescription(*scene, ThreadContext::Capture(0));
             }
 
             // intent from OStimNetMetaData
@@ -820,7 +836,7 @@ namespace OStimNavigator {
                 mgr.InvokeScript("receiveAutoDescription('')");
                 return;
             }
-            InvokeWithString(mgr, "receiveAutoDescription", BuildSceneDescription(*scene, 0));
+            InvokeWithString(mgr, "receiveAutoDescription", BuildSceneDescription(*scene, ThreadContext::Capture(0)));
         });
     }
 
@@ -954,12 +970,9 @@ namespace OStimNavigator {
 
             // Read the file on a background thread to avoid stalling the game loop.
             std::thread([filePath]() {
-                std::ifstream file(filePath, std::ios::binary);
+                SceneTagWriter::Flush(filePath);
                 std::string raw;
-                if (file.is_open()) {
-                    raw.assign(std::istreambuf_iterator<char>(file),
-                               std::istreambuf_iterator<char>());
-                }
+                JsonUtils::ReadFile(filePath, raw);
 
                 SKSE::GetTaskInterface()->AddTask([raw]() {
                     auto& mgr = PrismaUIManager::GetSingleton();
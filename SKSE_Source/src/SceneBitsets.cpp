@@ -0,0 +1,123 @@
+#include "SceneBitsets.h"
+#include "SceneDatabase.h"
+#include <algorithm>
+#include <emmintrin.h>
+
+namespace OStimNavigator {
+
+    namespace {
+        // SSE2 is part of x86-64, so every supported CPU has it.
+        bool RowMatches(const uint64_t* row, const uint64_t* mask, uint32_t stride, bool matchAll) {
+            __m128i acc = _mm_setzero_si128();
+            for (uint32_t w = 0; w < stride; w += 2) {
+                const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + w));
+                const __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + w));
+                const __m128i hit = _mm_and_si128(r, m);
+                // Has all: collect mask bits the row lacks. Has any: collect hits.
+                acc = _mm_or_si128(acc, matchAll ? _mm_xor_si128(hit, m) : hit);
+            }
+            const bool zero = _mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128())) == 0xFFFF;
+            return matchAll ? zero : !zero;
+        }
+
+        std::vector<Symbol> SortedKeys(const SceneIndexes::SymbolIndex& index) {
+            std::vector<Symbol> keys;
+            keys.reserve(index.size());
+            for (const auto& [key, scenes] : index) {
+                keys.push_back(key);
+            }
+            std::sort(keys.begin(), keys.end(), [](Symbol a, Symbol b) { return a.Id() < b.Id(); });
+            return keys;
+        }
+
+        // Scene rows straight from the posting lists
+        void BuildFromIndex(BitsetTable& table, uint32_t rowCount, const SceneIndexes::SymbolIndex& index) {
+            table.Reset(rowCount, SortedKeys(index));
+            for (const auto& [key, scenes] : index) {
+                for (uint32_t scene : scenes) {
+                    table.Set(scene, key);
+                }
+            }
+        }
+    }
+
+    void BitsetTable::Reset(uint32_t rowCount, std::span<const Symbol> vocabulary) {
+        m_bits.clear();
+        for (Symbol value : vocabulary) {
+            m_bits.emplace(value, static_cast<uint32_t>(m_bits.size()));
+        }
+        const uint32_t words = (static_cast<uint32_t>(m_bits.size()) + 63) / 64;
+        m_stride = std::max<uint32_t>(2, (words + 1) & ~1u);
+        m_rowCount = rowCount;
+        m_words.assign(static_cast<size_t>(m_stride) * rowCount, 0);
+    }
+
+    void BitsetTable::Set(uint32_t row, Symbol value) {
+        auto it = m_bits.find(value);
+        if (it != m_bits.end()) {
+            m_words[static_cast<size_t>(row) * m_stride + it->second / 64] |= uint64_t{1} << (it->second % 64);
+        }
+    }
+
+    BitsetTable::Mask BitsetTable::Compile(std::span<const Symbol> selected) const {
+        Mask mask;
+        mask.words.assign(m_stride, 0);
+        for (Symbol value : selected) {
+            auto it = m_bits.find(value);
+            if (it == m_bits.end()) {
+                mask.unsatisfiable = true;
+                continue;
+            }
+            mask.words[it->second / 64] |= uint64_t{1} << (it->second % 64);
+            mask.empty = false;
+        }
+        return mask;
+    }
+
+    bool BitsetTable::Matches(uint32_t row, const Mask& mask, bool matchAll) const {
+        if (matchAll ? mask.unsatisfiable : mask.empty) {
+            return false;
+        }
+        return RowMatches(m_words.data() + static_cast<size_t>(row) * m_stride, mask.words.data(), m_stride, matchAll);
+    }
+
+    void BitsetTable::Filter(const Mask& mask, bool matchAll, PostingList& rows) const {
+        if (matchAll ? mask.unsatisfiable : mask.empty) {
+            rows.clear();
+            return;
+        }
+        std::erase_if(rows, [&](uint32_t row) {
+            return !RowMatches(m_words.data() + static_cast<size_t>(row) * m_stride, mask.words.data(), m_stride, matchAll);
+        });
+    }
+
+    PostingList BitsetTable::Scan(const Mask& mask, bool matchAll) const {
+        PostingList rows;
+        if (matchAll ? mask.unsatisfiable : mask.empty) {
+            return rows;
+        }
+        const uint64_t* row = m_words.data();
+        for (uint32_t i = 0; i < m_rowCount; ++i, row += m_stride) {
+            if (RowMatches(row, mask.words.data(), m_stride, matchAll)) {
+                rows.push_back(i);
+            }
+        }
+        return rows;
+    }
+
+    void SceneBitsets::Build(const SceneColumns& columns, const SceneIndexes& indexes) {
+        const uint32_t sceneCount = columns.Size();
+        BuildFromIndex(sceneTags, sceneCount, indexes.sceneTags);
+        BuildFromIndex(actorTags, sceneCount, indexes.actorTags);
+        BuildFromIndex(actions, sceneCount, indexes.actions);
+        BuildFromIndex(actionTags, sceneCount, indexes.actionTags);
+
+        const uint32_t actorCount = sceneCount > 0 ? columns.actorOffsets[sceneCount] : 0;
+        actorTagsByActor.Reset(actorCount, SortedKeys(indexes.actorTags));
+        for (uint32_t actor = 0; actor < actorCount; ++actor) {
+            for (Symbol tag : columns.ActorTags(actor)) {
+                actorTagsByActor.Set(actor, tag);
+            }
+        }
+    }
+}
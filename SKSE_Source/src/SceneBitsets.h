@@ -0,0 +1,66 @@
+#pragma once
+
+#include "PCH.h"
+#include "SceneIndex.h"
+#include "SymbolTable.h"
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Fixed-width bitsets over the catalog vocabularies.
+ *
+ * Every distinct scene tag, actor tag, action type and action tag gets a bit,
+ * and each scene (or actor) stores the bits of the values it carries. A filter
+ * selection compiles into a mask of the same width, so "has all" is
+ * (row & mask) == mask and "has any" is (row & mask) != 0, tested 128 bits at a
+ * time. Built from SceneColumns and SceneIndexes, and replaced with them.
+ */
+
+namespace OStimNavigator {
+
+    struct SceneColumns;
+
+    class BitsetTable {
+    public:
+        // A compiled selection. Holds the same number of words as a row.
+        struct Mask {
+            std::vector<uint64_t> words;
+            bool unsatisfiable = false;     // Has all: a selected value never occurs
+            bool empty = true;              // No selected value occurs
+        };
+
+        // One zeroed row per index, with a bit for each vocabulary value.
+        void Reset(uint32_t rowCount, std::span<const Symbol> vocabulary);
+        void Set(uint32_t row, Symbol value);
+
+        Mask Compile(std::span<const Symbol> selected) const;
+
+        bool Matches(uint32_t row, const Mask& mask, bool matchAll) const;
+
+        // Keep only the rows in list that match
+        void Filter(const Mask& mask, bool matchAll, PostingList& rows) const;
+
+        // Every row that matches
+        PostingList Scan(const Mask& mask, bool matchAll) const;
+
+        uint32_t Size() const { return m_rowCount; }
+
+    private:
+        std::unordered_map<Symbol, uint32_t> m_bits;
+        std::vector<uint64_t> m_words;      // Row-major, m_stride words per row
+        uint32_t m_stride = 0;              // Multiple of two (one 128-bit block)
+        uint32_t m_rowCount = 0;
+    };
+
+    struct SceneBitsets {
+        BitsetTable sceneTags;              // Rows are scenes
+        BitsetTable actorTags;              // Rows are scenes: the tags of all their actors
+        BitsetTable actorTagsByActor;       // Rows are SceneColumns actor numbers
+        BitsetTable actions;
+        BitsetTable actionTags;
+
+        void Build(const SceneColumns& columns, const SceneIndexes& indexes);
+    };
+}
@@ -0,0 +1,94 @@
+#include "SceneBundle.h"
+
+namespace OStimNavigator {
+    namespace SceneBundle {
+
+        namespace {
+            constexpr uint32_t kBundleMagic = 0x42534E4F;  // "ONSB"
+        }
+
+        // ── Reader ───────────────────────────────────────────────────────────
+
+        Reader::Reader(const std::filesystem::path& path) {
+            auto file = std::make_unique<SceneCatalogCache::MappedFile>(path);
+            if (!file->IsOpen()) {
+                return;
+            }
+
+            SceneCatalogCache::BinaryReader reader(file->Data(), file->Size());
+            if (reader.U32() != kBundleMagic || reader.U32() != kFormatVersion) {
+                SKSE::log::info("SceneBundle: {} has an old format, it will be rebuilt", path.string());
+                return;
+            }
+
+            struct Pending {
+                SceneCatalogCache::FileStamp stamp;
+                uint64_t offset;
+                uint64_t size;
+            };
+            std::vector<Pending> pending;
+            uint32_t count = reader.Count(sizeof(uint32_t) + 4 * sizeof(uint64_t));
+            pending.reserve(count);
+            for (uint32_t i = 0; i < count && !reader.Failed(); ++i) {
+                Pending& record = pending.emplace_back();
+                record.stamp = reader.Stamp();
+                record.offset = reader.U64();
+                record.size = reader.U64();
+            }
+            std::string_view blob = reader.StringView();
+
+            if (reader.Failed() || !reader.AtEnd()) {
+                SKSE::log::warn("SceneBundle: {} is corrupt, it will be rebuilt", path.string());
+                return;
+            }
+
+            std::unordered_map<std::string, Record> index;
+            index.reserve(pending.size());
+            for (auto& record : pending) {
+                if (record.offset > blob.size() || record.size > blob.size() - record.offset) {
+                    SKSE::log::warn("SceneBundle: {} is corrupt, it will be rebuilt", path.string());
+                    return;
+                }
+                std::string key = record.stamp.path;
+                index[std::move(key)] = { std::move(record.stamp), blob.substr(record.offset, record.size) };
+            }
+
+            m_index = std::move(index);
+            m_file = std::move(file);
+        }
+
+        std::optional<std::string_view> Reader::Find(const SceneCatalogCache::FileStamp& stamp) const {
+            auto it = m_index.find(stamp.path);
+            if (it == m_index.end() || !(it->second.stamp == stamp)) {
+                return std::nullopt;
+            }
+            return it->second.payload;
+        }
+
+        void Reader::Close() {
+            m_index.clear();
+            m_file.reset();
+        }
+
+        // ── Writer ───────────────────────────────────────────────────────────
+
+        void Writer::Add(const SceneCatalogCache::FileStamp& stamp, std::string_view payload) {
+            m_records.push_back({ stamp, m_blob.size(), payload.size() });
+            m_blob.append(payload);
+        }
+
+        bool Writer::SaveTo(const std::filesystem::path& path) const {
+            SceneCatalogCache::BinaryWriter writer;
+            writer.U32(kBundleMagic);
+            writer.U32(kFormatVersion);
+            writer.U32(static_cast<uint32_t>(m_records.size()));
+            for (const auto& record : m_records) {
+                writer.Stamp(record.stamp);
+                writer.U64(record.offset);
+                writer.U64(record.size);
+            }
+            writer.String(m_blob);
+            return writer.SaveTo(path);
+        }
+    }
+}
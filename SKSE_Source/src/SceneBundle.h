@@ -0,0 +1,78 @@
+#pragma once
+
+#include "PCH.h"
+#include "SceneCatalogCache.h"
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Single-file bundle of raw scene JSON payloads.
+ *
+ * Under a virtual filesystem (Mod Organizer) every small-file open is far more
+ * expensive than reading its bytes. The bundle stores the content of every
+ * scene file behind an index keyed by path and stamp, and is memory-mapped in
+ * one go. A payload is only handed out when the bundled stamp still matches the
+ * file on disk, so a stale bundle never changes what is loaded; it is rebuilt
+ * whenever the scene folder no longer matches it.
+ *
+ * Layout: magic, version, record count, records (stamp, offset, size), payload blob.
+ */
+
+namespace OStimNavigator {
+    namespace SceneBundle {
+
+        // Bump whenever the bundle layout changes.
+        constexpr uint32_t kFormatVersion = 1;
+
+        inline const std::filesystem::path kBundlePath = "Data/SKSE/Plugins/OStimNavigator/SceneBundle.bin";
+
+        // Read-only view of a bundle file. Payloads point into the mapping and
+        // stay valid until Close() or destruction.
+        class Reader {
+        public:
+            explicit Reader(const std::filesystem::path& path);
+
+            bool IsOpen() const { return m_file != nullptr; }
+            size_t Size() const { return m_index.size(); }
+
+            // Bundled content of the file, if the bundle holds it at exactly this stamp.
+            std::optional<std::string_view> Find(const SceneCatalogCache::FileStamp& stamp) const;
+
+            // Release the mapping (required before the bundle file can be replaced).
+            void Close();
+
+        private:
+            struct Record {
+                SceneCatalogCache::FileStamp stamp;
+                std::string_view payload;
+            };
+
+            std::unique_ptr<SceneCatalogCache::MappedFile> m_file;
+            std::unordered_map<std::string, Record> m_index;     // Keyed by UTF-8 path
+        };
+
+        // Builds a new bundle in memory.
+        class Writer {
+        public:
+            void Add(const SceneCatalogCache::FileStamp& stamp, std::string_view payload);
+            size_t Size() const { return m_records.size(); }
+
+            bool SaveTo(const std::filesystem::path& path) const;
+
+        private:
+            struct Record {
+                SceneCatalogCache::FileStamp stamp;
+                uint64_t offset = 0;
+                uint64_t size = 0;
+            };
+
+            std::vector<Record> m_records;
+            std::string m_blob;
+        };
+    }
+}
@@ -0,0 +1,229 @@
+#include "SceneCatalogCache.h"
+#include "JsonUtils.h"
+#include "OStimNetMetaData.h"
+#include <Windows.h>
+#include <fstream>
+
+namespace OStimNavigator {
+    namespace SceneCatalogCache {
+
+        namespace {
+            std::string ToUtf8(const std::filesystem::path& path) {
+                auto u8 = path.u8string();
+                return std::string(u8.begin(), u8.end());
+            }
+
+            std::filesystem::path FromUtf8(const std::string& str) {
+                return std::filesystem::path(std::u8string(str.begin(), str.end()));
+            }
+        }
+
+        FileStamp StampEntry(const std::filesystem::directory_entry& entry) {
+            FileStamp stamp;
+            stamp.path = ToUtf8(entry.path());
+            std::error_code ec;
+            stamp.size = entry.file_size(ec);
+            if (ec) stamp.size = 0;
+            auto mtime = entry.last_write_time(ec);
+            stamp.mtime = ec ? 0 : static_cast<int64_t>(mtime.time_since_epoch().count());
+            return stamp;
+        }
+
+        FileStamp StampEntry(const DirectoryListing::JsonFile& file) {
+            FileStamp stamp;
+            stamp.path = ToUtf8(file.path);
+            stamp.size = file.size;
+            stamp.mtime = file.mtime;
+            return stamp;
+        }
+
+        FileStamp StampFile(const std::filesystem::path& path) {
+            std::error_code ec;
+            std::filesystem::directory_entry entry(path, ec);
+            if (ec || !entry.exists(ec)) {
+                FileStamp missing;
+                missing.path = ToUtf8(path);
+                return missing;
+            }
+            return StampEntry(entry);
+        }
+
+        std::vector<FileStamp> StampDependencies() {
+            std::vector<FileStamp> stamps;
+            JsonUtils::ForEachJsonFile("Data/SKSE/Plugins/OStim/actions",
+                [&stamps](const DirectoryListing::JsonFile& file) {
+                    stamps.push_back(StampEntry(file));
+                });
+            stamps.push_back(StampFile(OStimNetMetaData::GetMetaFilePath()));
+            return stamps;
+        }
+
+        uint64_t HashContent(std::string_view content) {
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for (unsigned char c : content) {
+                hash ^= c;
+                hash *= 0x100000001b3ull;
+            }
+            return hash;
+        }
+
+        bool HashFile(const std::filesystem::path& path, uint64_t& hash) {
+            thread_local std::string content;
+            if (!JsonUtils::ReadFile(path, content)) {
+                return false;
+            }
+            hash = HashContent(content);
+            return true;
+        }
+
+        // ── BinaryWriter ─────────────────────────────────────────────────────
+
+        void BinaryWriter::String(std::string_view v) {
+            U32(static_cast<uint32_t>(v.size()));
+            Raw(v.data(), v.size());
+        }
+
+        void BinaryWriter::Strings(const std::vector<std::string>& v) {
+            U32(static_cast<uint32_t>(v.size()));
+            for (const auto& s : v) String(s);
+        }
+
+        void BinaryWriter::StringSet(const std::unordered_set<std::string>& v) {
+            U32(static_cast<uint32_t>(v.size()));
+            for (const auto& s : v) String(s);
+        }
+
+        void BinaryWriter::Path(const std::filesystem::path& v) {
+            String(ToUtf8(v));
+        }
+
+        void BinaryWriter::Stamp(const FileStamp& v) {
+            String(v.path);
+            U64(v.size);
+            I64(v.mtime);
+        }
+
+        void BinaryWriter::Stamps(const std::vector<FileStamp>& v) {
+            U32(static_cast<uint32_t>(v.size()));
+            for (const auto& stamp : v) Stamp(stamp);
+        }
+
+        bool BinaryWriter::SaveTo(const std::filesystem::path& path) const {
+            std::error_code ec;
+            std::filesystem::create_directories(path.parent_path(), ec);
+
+            auto tmpPath = path;
+            tmpPath += ".tmp";
+            {
+                std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+                if (!out.is_open()) {
+                    SKSE::log::warn("SceneCatalogCache: could not open {} for writing", tmpPath.string());
+                    return false;
+                }
+                out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+                if (!out) {
+                    SKSE::log::warn("SceneCatalogCache: failed writing {}", tmpPath.string());
+                    return false;
+                }
+            }
+
+            std::filesystem::rename(tmpPath, path, ec);
+            if (ec) {
+                SKSE::log::warn("SceneCatalogCache: could not replace {}: {}", path.string(), ec.message());
+                std::filesystem::remove(tmpPath, ec);
+                return false;
+            }
+            return true;
+        }
+
+        // ── BinaryReader ─────────────────────────────────────────────────────
+
+        uint32_t BinaryReader::Count(size_t minElementSize) {
+            uint32_t count = U32();
+            if (m_failed || static_cast<size_t>(m_end - m_cur) / minElementSize < count) {
+                m_failed = true;
+                return 0;
+            }
+            return count;
+        }
+
+        std::string BinaryReader::String() {
+            uint32_t length = Count(1);
+            std::string value(m_cur, m_cur + length);
+            m_cur += length;
+            return value;
+        }
+
+        std::string_view BinaryReader::StringView() {
+            uint32_t length = Count(1);
+            std::string_view value(m_cur, length);
+            m_cur += length;
+            return value;
+        }
+
+        std::vector<std::string> BinaryReader::Strings() {
+            std::vector<std::string> values;
+            uint32_t count = Count(sizeof(uint32_t));
+            values.reserve(count);
+            for (uint32_t i = 0; i < count && !m_failed; ++i) values.push_back(String());
+            return values;
+        }
+
+        std::unordered_set<std::string> BinaryReader::StringSet() {
+            std::unordered_set<std::string> values;
+            uint32_t count = Count(sizeof(uint32_t));
+            values.reserve(count);
+            for (uint32_t i = 0; i < count && !m_failed; ++i) values.insert(String());
+            return values;
+        }
+
+        std::filesystem::path BinaryReader::Path() {
+            return FromUtf8(String());
+        }
+
+        FileStamp BinaryReader::Stamp() {
+            FileStamp stamp;
+            stamp.path = String();
+            stamp.size = U64();
+            stamp.mtime = I64();
+            return stamp;
+        }
+
+        std::vector<FileStamp> BinaryReader::Stamps() {
+            std::vector<FileStamp> stamps;
+            uint32_t count = Count(sizeof(uint32_t) + sizeof(uint64_t) + sizeof(int64_t));
+            stamps.reserve(count);
+            for (uint32_t i = 0; i < count && !m_failed; ++i) stamps.push_back(Stamp());
+            return stamps;
+        }
+
+        // ── MappedFile ───────────────────────────────────────────────────────
+
+        MappedFile::MappedFile(const std::filesystem::path& path) {
+            HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                return;
+            }
+            m_file = file;
+
+            LARGE_INTEGER size{};
+            if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+                return;
+            }
+            m_size = static_cast<size_t>(size.QuadPart);
+
+            m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!m_mapping) {
+                return;
+            }
+            m_view = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+        }
+
+        MappedFile::~MappedFile() {
+            if (m_view) UnmapViewOfFile(m_view);
+            if (m_mapping) CloseHandle(m_mapping);
+            if (m_file) CloseHandle(m_file);
+        }
+    }
+}
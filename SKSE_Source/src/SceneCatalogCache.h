@@ -0,0 +1,158 @@
+#pragma once
+
+#include "PCH.h"
+#include "DirectoryListing.h"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * Binary snapshot of the parsed scene catalog.
+ *
+ * The snapshot stores one record per scene file together with its stamp
+ * (path, size, mtime) and a content hash. On the next launch only files whose
+ * stamp no longer matches are parsed again; everything else comes straight
+ * from the snapshot. A change to any of the dependency files (which influence
+ * what every scene parses to) discards the snapshot as a whole.
+ */
+
+namespace OStimNavigator {
+    namespace SceneCatalogCache {
+
+        // Bump whenever the serialized layout of SceneData or the snapshot changes.
+        constexpr uint32_t kFormatVersion = 5;
+
+        inline const std::filesystem::path kSnapshotPath = "Data/SKSE/Plugins/OStimNavigator/SceneCache.bin";
+
+        // Identity of a file on disk at the time the snapshot was taken.
+        struct FileStamp {
+            std::string path;           // UTF-8 path as enumerated
+            uint64_t size = 0;
+            int64_t mtime = 0;          // file_time_type ticks, 0 if the file is missing
+
+            bool operator==(const FileStamp&) const = default;
+        };
+
+        // Stamp from a directory entry (uses the data cached during enumeration).
+        FileStamp StampEntry(const std::filesystem::directory_entry& entry);
+
+        // Stamp from a listed file (uses the size and mtime from its listing).
+        FileStamp StampEntry(const DirectoryListing::JsonFile& file);
+
+        // Stamp by path; a missing file yields a stamp with size and mtime of 0.
+        FileStamp StampFile(const std::filesystem::path& path);
+
+        // Files outside the scene folder whose contents change what a scene parses to
+        // (action aliases and OStimNet metadata). Any change here invalidates the snapshot.
+        std::vector<FileStamp> StampDependencies();
+
+        // 64-bit FNV-1a over raw file bytes.
+        uint64_t HashContent(std::string_view content);
+
+        // Hash a file on disk. Returns false if it could not be read.
+        bool HashFile(const std::filesystem::path& path, uint64_t& hash);
+
+        // Appends little-endian primitives to an in-memory buffer.
+        class BinaryWriter {
+        public:
+            void U8(uint8_t v) { Raw(&v, sizeof(v)); }
+            void I8(int8_t v) { Raw(&v, sizeof(v)); }
+            void U32(uint32_t v) { Raw(&v, sizeof(v)); }
+            void U64(uint64_t v) { Raw(&v, sizeof(v)); }
+            void I32(int32_t v) { Raw(&v, sizeof(v)); }
+            void I64(int64_t v) { Raw(&v, sizeof(v)); }
+            void F32(float v) { Raw(&v, sizeof(v)); }
+            void Bool(bool v) { U8(v ? 1 : 0); }
+            void String(std::string_view v);
+            void Strings(const std::vector<std::string>& v);
+            void StringSet(const std::unordered_set<std::string>& v);
+            void Path(const std::filesystem::path& v);
+            void Stamp(const FileStamp& v);
+            void Stamps(const std::vector<FileStamp>& v);
+
+            const std::string& Buffer() const { return m_buffer; }
+
+            // Write the buffer to a temporary file and swap it into place.
+            bool SaveTo(const std::filesystem::path& path) const;
+
+        private:
+            void Raw(const void* data, size_t size) { m_buffer.append(static_cast<const char*>(data), size); }
+
+            std::string m_buffer;
+        };
+
+        // Bounds-checked reader over a byte range. Any overrun sets the failed flag
+        // and every later read returns a default value.
+        class BinaryReader {
+        public:
+            BinaryReader(const char* data, size_t size) : m_cur(data), m_end(data + size) {}
+
+            uint8_t U8() { return Pod<uint8_t>(); }
+            int8_t I8() { return Pod<int8_t>(); }
+            uint32_t U32() { return Pod<uint32_t>(); }
+            uint64_t U64() { return Pod<uint64_t>(); }
+            int32_t I32() { return Pod<int32_t>(); }
+            int64_t I64() { return Pod<int64_t>(); }
+            float F32() { return Pod<float>(); }
+            bool Bool() { return U8() != 0; }
+            std::string String();
+            std::string_view StringView();      // Points into the underlying buffer
+            std::vector<std::string> Strings();
+            std::unordered_set<std::string> StringSet();
+            std::filesystem::path Path();
+            FileStamp Stamp();
+            std::vector<FileStamp> Stamps();
+
+            // Reads an element count, guarding it so a corrupt length can't trigger a
+            // huge allocation (each element needs at least minElementSize bytes).
+            uint32_t Count(size_t minElementSize);
+
+            bool Failed() const { return m_failed; }
+            bool AtEnd() const { return m_cur == m_end; }
+
+            // Mark the data as corrupt after a value failed validation.
+            void Fail() { m_failed = true; }
+
+        private:
+            template <typename T>
+            T Pod() {
+                T value{};
+                if (m_failed || static_cast<size_t>(m_end - m_cur) < sizeof(T)) {
+                    m_failed = true;
+                    return value;
+                }
+                std::memcpy(&value, m_cur, sizeof(T));
+                m_cur += sizeof(T);
+                return value;
+            }
+
+            const char* m_cur;
+            const char* m_end;
+            bool m_failed = false;
+        };
+
+        // Read-only memory mapping of a whole file.
+        class MappedFile {
+        public:
+            explicit MappedFile(const std::filesystem::path& path);
+            ~MappedFile();
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            bool IsOpen() const { return m_view != nullptr; }
+            const char* Data() const { return static_cast<const char*>(m_view); }
+            size_t Size() const { return m_size; }
+
+        private:
+            void* m_file = nullptr;
+            void* m_mapping = nullptr;
+            const void* m_view = nullptr;
+            size_t m_size = 0;
+        };
+    }
+}
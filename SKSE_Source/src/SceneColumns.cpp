@@ -0,0 +1,115 @@
+#include "SceneDatabase.h"
+#include "ActionDatabase.h"
+#include "SceneSimilarity.h"
+#include <algorithm>
+
+namespace OStimNavigator {
+
+    void SceneColumns::Build(SceneCatalog& catalog) {
+        *this = {};
+
+        scenes.reserve(catalog.size());
+        for (auto& [id, scene] : catalog) {
+            scenes.push_back(&scene);
+        }
+        std::sort(scenes.begin(), scenes.end(),
+            [](const SceneData* a, const SceneData* b) { return a->id < b->id; });
+
+        const size_t count = scenes.size();
+        actorCount.reserve(count);
+        flags.reserve(count);
+        furnitureType.reserve(count);
+        modpack.reserve(count);
+        tagOffsets.reserve(count + 1);
+        actionOffsets.reserve(count + 1);
+        requirementOffsets.reserve(count + 1);
+        actorOffsets.reserve(count + 1);
+
+        static const Symbol intro = Symbol::Intern("intro");
+        static const Symbol idle = Symbol::Intern("idle");
+        static const Symbol sexual = Symbol::Intern("sexual");
+        static const Symbol sensual = Symbol::Intern("sensual");
+        static const Symbol romantic = Symbol::Intern("romantic");
+        auto& actionDB = ActionDatabase::GetSingleton();
+
+        tagOffsets.push_back(0);
+        actionOffsets.push_back(0);
+        requirementOffsets.push_back(0);
+        requirementStride = actionDB.RequirementWords();
+        actorOffsets.push_back(0);
+        actorTagOffsets.push_back(0);
+
+        for (const SceneData* scene : scenes) {
+            uint8_t sceneFlags = 0;
+            if (scene->isTransition) sceneFlags |= kTransition;
+            if (scene->noRandomSelection) sceneFlags |= kNoRandomSelection;
+            for (Symbol tag : scene->tags) {
+                Symbol lowerTag = tag.Folded();
+                if (lowerTag == intro || lowerTag == idle) {
+                    sceneFlags |= kIntroOrIdle;
+                }
+            }
+
+            actorCount.push_back(scene->actorCount);
+            flags.push_back(sceneFlags);
+            furnitureType.push_back(scene->furnitureType);
+            modpack.push_back(scene->modpack);
+
+            tags.insert(tags.end(), scene->tags.begin(), scene->tags.end());
+            tagOffsets.push_back(static_cast<uint32_t>(tags.size()));
+
+            for (const auto& action : scene->actions) {
+                uint8_t categories = 0;
+                if (actionDB.ActionHasTag(action.type, sexual)) categories |= kSexual;
+                if (actionDB.ActionHasTag(action.type, sensual)) categories |= kSensual;
+                if (actionDB.ActionHasTag(action.type, romantic)) categories |= kRomantic;
+                actions.push_back(action);
+                actionCategories.push_back(categories);
+            }
+            actionOffsets.push_back(static_cast<uint32_t>(actions.size()));
+
+            // Requirements per slot, folded over every action and role
+            const size_t firstRequirement = requirementOffsets.back();
+            auto require = [&](int slot, const RequirementMask& mask) {
+                if (slot < 0 || std::none_of(mask.begin(), mask.end(), [](uint64_t word) { return word != 0; })) return;
+                const size_t index = firstRequirement + static_cast<size_t>(slot);
+                if ((index + 1) * requirementStride > requirementWords.size()) {
+                    requirementWords.resize((index + 1) * requirementStride, 0);
+                }
+                uint64_t* words = requirementWords.data() + index * requirementStride;
+                for (uint32_t w = 0; w < requirementStride && w < mask.size(); ++w) {
+                    words[w] |= mask[w];
+                }
+            };
+            for (const auto& action : scene->actions) {
+                if (const ActionData* data = actionDB.GetAction(action.type)) {
+                    require(action.actor, data->actorRequirementMask);
+                    require(action.target, data->targetRequirementMask);
+                    require(action.performer, data->performerRequirementMask);
+                }
+            }
+            requirementOffsets.push_back(static_cast<uint32_t>(
+                requirementStride ? requirementWords.size() / requirementStride : 0));
+
+            for (const auto& actor : scene->actors) {
+                actorSex.push_back(actor.intendedSex.Folded());
+                actorPositions.push_back(SceneSimilarity::GetPositionMask(actor.tags));
+                actorTags.insert(actorTags.end(), actor.tags.begin(), actor.tags.end());
+                actorTagOffsets.push_back(static_cast<uint32_t>(actorTags.size()));
+            }
+            actorOffsets.push_back(static_cast<uint32_t>(actorSex.size()));
+        }
+    }
+
+    std::optional<uint32_t> SceneColumns::IndexOf(const SceneData* scene) const {
+        if (!scene) {
+            return std::nullopt;
+        }
+        auto it = std::lower_bound(scenes.begin(), scenes.end(), scene->id,
+            [](const SceneData* a, const std::string& id) { return a->id < id; });
+        if (it == scenes.end() || *it != scene) {
+            return std::nullopt;
+        }
+        return static_cast<uint32_t>(it - scenes.begin());
+    }
+}
@@ -5,17 +5,35 @@
 #include "SceneDescriptionData.h"
 #include "StringUtils.h"
 #include "JsonUtils.h"
+#include "SceneCatalogCache.h"
+#include "SceneTagWriter.h"
+#include "Settings.h"
+#include <atomic>
 #include <chrono>
-#include <fstream>
+#include <optional>
+#include <thread>
 
 namespace OStimNavigator {
 
+    namespace {
+        // Below this many files per worker, thread start-up costs more than it saves.
+        constexpr size_t kMinFilesPerWorker = 64;
+
+        constexpr uint32_t kSnapshotMagic = 0x43534E4F;  // "ONSC"
+    }
+
     void SceneDatabase::LoadScenes() {
         if (m_loaded) {
             return;
         }
 
+        RetireHandles();
         m_scenes.clear();
+        m_columns = {};
+        m_indexes = {};
+        m_bitsets = {};
+        m_searchIndex = {};
+        m_idTable = {};
         m_allTags.clear();
         m_allActions.clear();
         m_allActorTags.clear();
@@ -26,25 +44,157 @@ namespace OStimNavigator {
         std::filesystem::path scenesPath = "Data/SKSE/Plugins/OStim/scenes";
 
         auto t0 = std::chrono::steady_clock::now();
-        
-        JsonUtils::LoadJsonFilesFromDirectory(scenesPath,
-            [this](const std::filesystem::path& path) {
-                ParseSceneFile(path);
+
+        // Enumerate first so the file list can be split across workers. The
+        // stamps double as the snapshot manifest.
+        std::vector<SceneFileEntry> entries;
+        JsonUtils::ForEachJsonFile(scenesPath,
+            [&entries](const DirectoryListing::JsonFile& file) {
+                SceneFileEntry& entry = entries.emplace_back();
+                entry.path = file.path;
+                entry.stamp = SceneCatalogCache::StampEntry(file);
             },
             true);  // recursive
 
+        // Reuse snapshot records whose file is unchanged; everything else is parsed.
+        const auto& settings = Settings::GetSingleton();
+        std::vector<SceneCatalogCache::FileStamp> dependencies;
+        std::unordered_map<std::string, SceneFileEntry> cached;
+        if (settings.sceneCache) {
+            dependencies = SceneCatalogCache::StampDependencies();
+            LoadSnapshot(dependencies, cached);
+        }
+
+        // Raw payloads from the bundle stand in for opening files one by one.
+        std::optional<SceneBundle::Reader> bundle;
+        if (settings.sceneBundle) {
+            bundle.emplace(SceneBundle::kBundlePath);
+        }
+
+        std::vector<size_t> toParse;
+        size_t restamped = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            auto& entry = entries[i];
+            auto it = cached.find(entry.stamp.path);
+            if (it == cached.end()) {
+                toParse.push_back(i);
+                continue;
+            }
+
+            bool reuse = it->second.stamp == entry.stamp;
+            if (!reuse && settings.sceneCacheContentHash && it->second.stamp.size == entry.stamp.size) {
+                // Same size, different mtime (e.g. a mod manager redeploy): compare contents.
+                uint64_t hash = 0;
+                reuse = SceneCatalogCache::HashFile(entry.path, hash) && hash == it->second.contentHash;
+                if (reuse) ++restamped;
+            }
+
+            if (reuse) {
+                auto path = std::move(entry.path);
+                auto stamp = std::move(entry.stamp);
+                entry = std::move(it->second);
+                entry.path = std::move(path);
+                entry.stamp = std::move(stamp);
+                // The file was never rewritten (the writer was off or the game exited
+                // first); a successful write changes its stamp and ends this.
+                if (!entry.pendingTags.empty() && settings.writeInjectedTags) {
+                    SceneTagWriter::Enqueue(entry.path, entry.pendingTags);
+                }
+            } else {
+                toParse.push_back(i);
+            }
+            cached.erase(it);
+        }
+        const size_t removed = cached.size();
+        cached.clear();
+
+        size_t threadCount = 0;
+        if (!toParse.empty()) {
+            threadCount = 1;
+            if (settings.parallelSceneLoad) {
+                threadCount = settings.sceneLoadThreads > 0
+                    ? settings.sceneLoadThreads
+                    : std::max(1u, std::thread::hardware_concurrency());
+                threadCount = std::min(threadCount, toParse.size() / kMinFilesPerWorker);
+                threadCount = std::max<size_t>(threadCount, 1);
+            }
+
+            JsonUtils::ReadStats readStats;
+
+            // Each worker takes a contiguous chunk and writes only to its own entries.
+            const size_t chunkSize = (toParse.size() + threadCount - 1) / threadCount;
+            std::atomic<size_t> fromBundle = 0;
+            auto parseChunk = [this, &entries, &toParse, &bundle, &fromBundle, chunkSize](size_t index) {
+                const size_t begin = index * chunkSize;
+                const size_t end = std::min(begin + chunkSize, toParse.size());
+                for (size_t i = begin; i < end; ++i) {
+                    auto& entry = entries[toParse[i]];
+                    if (bundle && bundle->IsOpen()) {
+                        if (auto payload = bundle->Find(entry.stamp)) {
+                            entry.content.assign(payload->data(), payload->size());
+                            entry.contentLoaded = true;
+                            ++fromBundle;
+                        }
+                    }
+                    ParseSceneFile(entry);
+                }
+            };
+
+            if (threadCount == 1) {
+                parseChunk(0);
+            } else {
+                std::vector<std::thread> workers;
+                workers.reserve(threadCount - 1);
+                for (size_t i = 1; i < threadCount; ++i) {
+                    workers.emplace_back(parseChunk, i);
+                }
+                parseChunk(0);
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+
+            for (size_t index : toParse) {
+                if (entries[index].contentLoaded) {
+                    ++readStats.files;
+                    readStats.bytes += entries[index].content.size();
+                }
+            }
+            readStats.Log("SceneDatabase");
+
+            if (fromBundle > 0) {
+                SKSE::log::info("SceneDatabase: read {} of {} scene file(s) from the bundle",
+                    fromBundle.load(), toParse.size());
+            }
+        }
+
+        if (settings.sceneCache && (!toParse.empty() || removed > 0 || restamped > 0)) {
+            SaveSnapshot(entries, dependencies);
+        }
+
+        if (bundle) {
+            UpdateBundle(entries, *bundle);
+        }
+
+        for (auto& entry : entries) {
+            MergeEntry(entry);
+        }
+        RebuildColumns();
+
         auto t1 = std::chrono::steady_clock::now();
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
         
-        SKSE::log::info("Loaded {} scenes in {} ms", m_scenes.size(), ms);
+        SKSE::log::info("Loaded {} scenes from {} files in {} ms ({} parsed on {} thread(s), {} from snapshot, {} removed)",
+            m_scenes.size(), entries.size(), ms, toParse.size(), threadCount,
+            entries.size() - toParse.size(), removed);
 
         // ── Unknown tag audit ────────────────────────────────────────────────
         // Actor tags not in kActorTagSuggestions
         {
             std::unordered_set<std::string> known(kActorTagSuggestions.begin(), kActorTagSuggestions.end());
             std::vector<std::string> unknown;
-            for (const auto& tag : m_allActorTags) {
-                if (!known.count(tag)) unknown.push_back(tag);
+            for (Symbol tag : m_allActorTags) {
+                if (!known.count(tag.str())) unknown.push_back(tag.str());
             }
             if (!unknown.empty()) {
                 std::sort(unknown.begin(), unknown.end());
@@ -58,11 +208,11 @@ namespace OStimNavigator {
         }
         // Scene tags not in kPositions / kPositionAliases
         {
-            std::unordered_set<std::string> known(kPositions.begin(), kPositions.end());
+            std::unordered_set<std::string_view> known(kPositions.begin(), kPositions.end());
             for (const auto& [alias, _] : kPositionAliases) known.insert(alias);
             std::vector<std::string> unknown;
-            for (const auto& tag : m_allTags) {
-                if (!known.count(tag)) unknown.push_back(tag);
+            for (Symbol tag : m_allTags) {
+                if (!known.count(tag.str())) unknown.push_back(tag.str());
             }
             if (!unknown.empty()) {
                 std::sort(unknown.begin(), unknown.end());
@@ -92,44 +242,46 @@ namespace OStimNavigator {
     }
 
     void SceneDatabase::ReloadScene(const std::string& id) {
-        std::string lowerID = id;
-        std::transform(lowerID.begin(), lowerID.end(), lowerID.begin(), ::tolower);
-
-        auto it = m_scenes.find(lowerID);
+        auto it = m_scenes.find(id);
         if (it == m_scenes.end()) {
             SKSE::log::warn("SceneDatabase::ReloadScene: scene '{}' not in cache — skipping", id);
             return;
         }
 
-        std::filesystem::path filePath = it->second.filePath;
-        SceneData backup = it->second;
-        m_scenes.erase(it);
-        ParseSceneFile(filePath);
-        if (m_scenes.find(lowerID) == m_scenes.end()) {
-            // Parse failed — restore previous data so the scene remains accessible.
+        SceneFileEntry entry;
+        entry.path = it->second.filePath;
+        ParseSceneFile(entry);
+        const bool parsed = entry.parsed;
+        MergeEntry(entry, true);
+        if (!parsed) {
+            // Parse failed — the previous data was never removed, so the scene remains accessible.
             SKSE::log::warn("SceneDatabase::ReloadScene: parse failed for '{}', keeping previous data", id);
-            m_scenes[lowerID] = std::move(backup);
             return;
         }
-        SKSE::log::info("SceneDatabase::ReloadScene: refreshed '{}' from {}", id, filePath.string());
+        RebuildColumns();
+        SKSE::log::info("SceneDatabase::ReloadScene: refreshed '{}' from {}", id, entry.path.string());
     }
 
-    void SceneDatabase::ParseSceneFile(const std::filesystem::path& filePath) {
+    void SceneDatabase::ParseSceneFile(SceneFileEntry& entry) {
+        const std::filesystem::path& filePath = entry.path;
         try {
-            // Read raw bytes first so we can detect the original line ending style.
-            std::ifstream rawFile(filePath, std::ios::binary);
-            if (!rawFile.is_open()) {
-                SKSE::log::warn("Failed to open scene file: {}", filePath.string());
-                return;
+            // LoadScenes may already have filled the raw bytes in from the scene bundle.
+            if (!entry.contentLoaded) {
+                if (!JsonUtils::ReadFile(filePath, entry.content)) {
+                    SKSE::log::warn("Failed to open scene file: {}", filePath.string());
+                    return;
+                }
+                entry.contentLoaded = true;
+            }
+            const std::string& rawContent = entry.content;
+            entry.contentHash = SceneCatalogCache::HashContent(rawContent);
+
+            // Stream the file, keeping only the fields below (no DOM is built).
+            SceneJson::SceneFields fields;
+            SceneJson::Read(rawContent, fields);
+            if (!fields.isObject) {
+                throw std::runtime_error("scene file is not a JSON object");
             }
-            std::string rawContent((std::istreambuf_iterator<char>(rawFile)),
-                                    std::istreambuf_iterator<char>());
-            rawFile.close();
-
-            // Detect whether the file uses CRLF so we can restore it on write-back.
-            const bool hasCRLF = rawContent.find("\r\n") != std::string::npos;
-
-            nlohmann::ordered_json j = nlohmann::ordered_json::parse(rawContent);
 
             SceneData scene;
             scene.id = filePath.stem().string();
@@ -137,47 +289,49 @@ namespace OStimNavigator {
             scene.filePath = filePath;
 
             // Parse basic fields
-            scene.name = j.value("name", scene.id);
-            scene.modpack = j.contains("modpack") ? j.value("modpack", "") : j.value("modPack", "");
-            scene.length = j.value("length", 0.0f);
-            scene.noRandomSelection = j.value("noRandomSelection", false);
-            scene.furnitureType = j.value("furniture", "");
+            scene.name = fields.name.Has() ? SceneJson::AsString(fields.name, "name") : scene.id;
+            scene.modpack = Symbol::Intern(fields.modpack.Has() ? SceneJson::AsString(fields.modpack, "modpack")
+                          : fields.modPack.Has() ? SceneJson::AsString(fields.modPack, "modPack") : "");
+            scene.length = fields.length.Has() ? SceneJson::AsFloat(fields.length, "length") : 0.0f;
+            scene.noRandomSelection = fields.noRandomSelection.Has() && SceneJson::AsBool(fields.noRandomSelection, "noRandomSelection");
+            scene.furnitureType = Symbol::Intern(fields.furniture.Has() ? SceneJson::AsString(fields.furniture, "furniture") : "");
 
             // Check if transition
-            if (j.contains("destination")) {
+            if (fields.destination.Has()) {
                 scene.isTransition = true;
-                scene.destination = j["destination"].get<std::string>();
+                scene.destination = SceneJson::AsString(fields.destination, "destination");
             }
 
             // Parse speeds[0].animation -> scene.firstSpeedAnimation
-            if (j.contains("speeds") && j["speeds"].is_array() && !j["speeds"].empty()) {
-                const auto& speedObj = j["speeds"][0];
-                if (speedObj.contains("animation") && speedObj["animation"].is_string()) {
-                    scene.firstSpeedAnimation = speedObj["animation"].get<std::string>();
-                }
+            if (fields.speeds.IsArray() && fields.speedCount > 0 && fields.firstSpeed.IsObject() &&
+                fields.firstSpeedAnimation.IsString()) {
+                scene.firstSpeedAnimation = fields.firstSpeedAnimation.string;
             }
 
             if (scene.id.starts_with("ostim") && !scene.firstSpeedAnimation.empty()) {
                 std::string lowerAnim = scene.firstSpeedAnimation;
                 StringUtils::ToLower(lowerAnim);
-                m_animationToOStimSceneId[lowerAnim] = scene.id;
+                entry.partial.animation = lowerAnim;
             }
 
             // Parse actors, tags, and actions
-            ParseActors(j, scene);
+            entry.scene.id = scene.id;
+            ParseActors(fields, scene, entry.partial);
             
-            if (j.contains("tags") && j["tags"].is_array()) {
-                for (const auto& tag : j["tags"]) {
-                    std::string tagStr = tag.get<std::string>();
+            if (fields.tags.IsArray()) {
+                for (const auto& tag : fields.tagValues) {
+                    std::string tagStr = SceneJson::AsString(tag, "tags");
                     StringUtils::ToLower(tagStr);
-                    scene.tags.push_back(tagStr);
-                    m_allTags.insert(tagStr);
+                    Symbol tagSymbol = Symbol::Intern(tagStr);
+                    scene.tags.push_back(tagSymbol);
+                    entry.partial.tags.push_back(tagSymbol);
                 }
             }
 
-            ParseActions(j, scene);
+            ParseActions(fields, scene, entry.partial);
 
-            // Merge OStimNet metadata (intent + positions) into scene tags and persist to file
+            // Merge OStimNet metadata (intent + positions) into scene tags. The file
+            // itself is updated later by SceneTagWriter (or never, as an overlay).
             // Skip core OStim scenes
             const SceneMeta* meta = scene.id.starts_with("ostim") ? nullptr : OStimNetMetaData::GetSingleton().GetSceneMeta(scene.id);
             if (meta) {
@@ -204,194 +358,534 @@ namespace OStimNavigator {
 
                 // Build set of existing JSON tags (lowercase) to avoid duplicates
                 std::unordered_set<std::string> existingTags;
-                if (j.contains("tags") && j["tags"].is_array())
-                    for (const auto& t : j["tags"])
-                        if (t.is_string()) existingTags.insert(t.get<std::string>());
+                if (fields.tags.IsArray())
+                    for (const auto& t : fields.tagValues)
+                        if (t.IsString()) existingTags.insert(t.string);
 
-                bool modified = false;
+                std::vector<std::string> added;
                 for (const auto& tag : toInject) {
                     if (!existingTags.count(tag)) {
-                        j["tags"].push_back(tag);
+                        // "tags" has to be absent, null or an array to take new entries
+                        if (fields.tags.Has() && fields.tags.kind != SceneJson::Value::Kind::Null && !fields.tags.IsArray()) {
+                            throw std::runtime_error(std::string("cannot add tags to a 'tags' value of type ") +
+                                                     SceneJson::KindName(fields.tags.kind));
+                        }
+                        added.push_back(tag);
                         existingTags.insert(tag);
                         // Also keep the in-memory scene in sync
-                        scene.tags.push_back(tag);
-                        m_allTags.insert(tag);
-                        modified = true;
+                        scene.tags.push_back(Symbol::Intern(tag));
                     }
                 }
 
                 SKSE::log::debug("SceneDatabase: merged {} tags into scene '{}'", toInject.size(), scene.id);
 
-                if (modified) {
-                    try {
-                        std::ofstream out(filePath, std::ios::binary);
-                        if (out.is_open()) {
-                            std::string dumped = j.dump(4);
-                            if (hasCRLF) {
-                                // Restore original CRLF line endings
-                                std::string converted;
-                                converted.reserve(dumped.size() + dumped.size() / 20);
-                                for (std::size_t i = 0; i < dumped.size(); ++i) {
-                                    if (dumped[i] == '\n' && (i == 0 || dumped[i - 1] != '\r'))
-                                        converted += '\r';
-                                    converted += dumped[i];
-                                }
-                                out << converted;
-                            } else {
-                                out << dumped;
-                            }
-                            SKSE::log::info("SceneDatabase: injected metadata tags into {}", filePath.string());
-                        } else {
-                            SKSE::log::warn("SceneDatabase: could not open {} for writing", filePath.string());
-                        }
-                    } catch (const std::exception& e) {
-                        SKSE::log::warn("SceneDatabase: failed to save {}: {}", filePath.string(), e.what());
-                    }
+                if (!added.empty() && Settings::GetSingleton().writeInjectedTags) {
+                    SceneTagWriter::Enqueue(filePath, added);
                 }
+                entry.pendingTags = std::move(added);
             }
 
-            // Collect positions from final scene tags (after OStimNet injection)
-            {
-                static const std::unordered_set<std::string> positionsSet(kPositions.begin(), kPositions.end());
-                for (const auto& tag : scene.tags) {
-                    if (positionsSet.count(tag)) {
-                        m_allPositions.insert(tag);
-                    } else {
-                        auto it = kPositionAliases.find(tag);
-                        if (it != kPositionAliases.end()) m_allPositions.insert(it->second);
-                    }
-                }
-            }
-
-            m_scenes[scene.id] = scene;
-
-            // Increment the scene count on the matched furniture type if this scene has
-            // at least one sexual action and is tied to a specific furniture type.
-            if (!scene.furnitureType.empty()) {
-                bool hasSexualAction = std::any_of(scene.actions.begin(), scene.actions.end(),
-                    [](const SceneActionData& a) { return kSexualActionTypes.count(a.type) > 0; });
-                if (hasSexualAction) {
-                    FurnitureDatabase::GetSingleton().IncrementSceneCount(scene.furnitureType);
-                }
-            }
+            // Positions, furniture counts and the global sets are derived from the
+            // finished scene when the entry is merged.
+            entry.scene = std::move(scene);
+            entry.parsed = true;
+            entry.partial = {};
 
         } catch (const std::exception& e) {
             SKSE::log::error("Error parsing scene file {}: {}", filePath.string(), e.what());
         }
     }
 
-    void SceneDatabase::ParseActors(const nlohmann::json& j, SceneData& scene) {
-        if (!j.contains("actors") || !j["actors"].is_array()) {
+    void SceneDatabase::ParseActors(const SceneJson::SceneFields& fields, SceneData& scene, SceneFileEntry::Partial& partial) {
+        if (!fields.actors.IsArray()) {
             return;
         }
 
-        const auto& actorsArray = j["actors"];
-        scene.actorCount = static_cast<uint32_t>(actorsArray.size());
+        scene.actorCount = static_cast<uint32_t>(fields.actorValues.size());
         
-        for (const auto& actorJson : actorsArray) {
+        for (const auto& actorJson : fields.actorValues) {
+            if (!actorJson.self.IsObject()) {
+                throw std::runtime_error(std::string("actor entry must be an object, but is ") +
+                                         SceneJson::KindName(actorJson.self.kind));
+            }
+
             ActorData actor;
             
-            if (actorJson.contains("intendedSex") && actorJson["intendedSex"].is_string()) {
-                actor.intendedSex = actorJson["intendedSex"].get<std::string>();
-                StringUtils::ToLower(actor.intendedSex);
+            if (actorJson.intendedSex.IsString()) {
+                actor.intendedSex = Symbol::Intern(StringUtils::ToLowerCopy(actorJson.intendedSex.string));
             }
             
-            actor.animationIndex = actorJson.value("animationIndex", -1);
+            actor.animationIndex = actorJson.animationIndex.Has() ? SceneJson::AsInt(actorJson.animationIndex, "animationIndex") : -1;
             
-            if (actorJson.contains("tags") && actorJson["tags"].is_array()) {
-                for (const auto& tagJson : actorJson["tags"]) {
-                    if (tagJson.is_string()) {
-                        std::string tag = tagJson.get<std::string>();
-                        StringUtils::ToLower(tag);
-                        actor.tags.push_back(tag);
-                        m_allActorTags.insert(tag);
+            if (actorJson.tags.IsArray()) {
+                std::vector<Symbol> tags;
+                for (const auto& tagJson : actorJson.tagValues) {
+                    if (tagJson.IsString()) {
+                        Symbol tag = Symbol::Intern(StringUtils::ToLowerCopy(tagJson.string));
+                        tags.push_back(tag);
+                        partial.actorTags.push_back(tag);
                     }
                 }
+                actor.tags = SymbolList::Intern(tags);
             }
             
             scene.actors.push_back(actor);
         }
     }
 
-    void SceneDatabase::ParseActions(const nlohmann::json& j, SceneData& scene) {
-        if (!j.contains("actions") || !j["actions"].is_array()) {
+    void SceneDatabase::ParseActions(const SceneJson::SceneFields& fields, SceneData& scene, SceneFileEntry::Partial& partial) {
+        if (!fields.actions.IsArray()) {
             return;
         }
 
-        for (const auto& actionObj : j["actions"]) {
-            if (!actionObj.contains("type")) {
+        for (const auto& actionObj : fields.actionValues) {
+            if (!actionObj.self.IsObject() || !actionObj.type.Has()) {
                 continue;
             }
 
             SceneActionData actionData;
-            std::string actionType = actionObj["type"].get<std::string>();
+            std::string actionType = SceneJson::AsString(actionObj.type, "type");
             StringUtils::ToLower(actionType);
-            actionData.type = ActionDatabase::GetSingleton().ResolveActionType(actionType);
+            actionData.type = Symbol::Intern(ActionDatabase::GetSingleton().ResolveActionType(actionType));
             
-            // Parse role indices using value() for cleaner code
-            actionData.actor = actionObj.value("actor", -1);
-            actionData.target = actionObj.value("target", -1);
-            actionData.performer = actionObj.value("performer", -1);
+            // Role indices default to -1 when absent
+            actionData.actor = actionObj.actor.Has() ? SceneActionData::ToRole(SceneJson::AsInt(actionObj.actor, "actor")) : -1;
+            actionData.target = actionObj.target.Has() ? SceneActionData::ToRole(SceneJson::AsInt(actionObj.target, "target")) : -1;
+            actionData.performer = actionObj.performer.Has() ? SceneActionData::ToRole(SceneJson::AsInt(actionObj.performer, "performer")) : -1;
             
             scene.actions.push_back(actionData);
-            m_allActions.insert(actionData.type);
-            ActionDatabase::GetSingleton().MarkUsedInScene(actionData.type);
+            partial.actions.push_back(actionData.type);
         }
     }
 
-    SceneData* SceneDatabase::GetSceneByID(const std::string& id) {
-        std::string lowerID = StringUtils::ToLowerCopy(id);
-        
-        auto it = m_scenes.find(lowerID);
+    void SceneDatabase::MergeEntry(SceneFileEntry& entry, bool reload) {
+        auto& actionDB = ActionDatabase::GetSingleton();
+
+        if (!entry.parsed) {
+            m_allTags.insert(entry.partial.tags.begin(), entry.partial.tags.end());
+            m_allActorTags.insert(entry.partial.actorTags.begin(), entry.partial.actorTags.end());
+            for (Symbol type : entry.partial.actions) {
+                m_allActions.insert(type);
+                actionDB.MarkUsedInScene(type.str());
+            }
+            if (!entry.partial.animation.empty()) {
+                m_animationToOStimSceneId[entry.partial.animation] = entry.scene.id;
+            }
+            return;
+        }
+
+        SceneData& scene = entry.scene;
+
+        m_allTags.insert(scene.tags.begin(), scene.tags.end());
+        for (const auto& actor : scene.actors) {
+            m_allActorTags.insert(actor.tags.begin(), actor.tags.end());
+        }
+        for (const auto& action : scene.actions) {
+            if (m_allActions.insert(action.type).second) {
+                actionDB.MarkUsedInScene(action.type.str());
+            }
+        }
+
+        if (scene.id.starts_with("ostim") && !scene.firstSpeedAnimation.empty()) {
+            m_animationToOStimSceneId[StringUtils::ToLowerCopy(scene.firstSpeedAnimation)] = scene.id;
+        }
+
+        // Collect positions from final scene tags (after OStimNet injection)
+        {
+            // Position tag or alias -> position
+            static const std::unordered_map<Symbol, Symbol> positionTags = [] {
+                std::unordered_map<Symbol, Symbol> map;
+                for (const auto& position : kPositions) {
+                    Symbol symbol = Symbol::Intern(position);
+                    map.emplace(symbol, symbol);
+                }
+                for (const auto& [alias, position] : kPositionAliases) {
+                    map.emplace(Symbol::Intern(alias), Symbol::Intern(position));
+                }
+                return map;
+            }();
+            for (Symbol tag : scene.tags) {
+                auto it = positionTags.find(tag);
+                if (it != positionTags.end()) m_allPositions.insert(it->second);
+            }
+        }
+
+        // Increment the scene count on the matched furniture type if this scene has
+        // at least one sexual action and is tied to a specific furniture type.
+        // A reload first takes back what the scene it replaces contributed.
+        auto countedFurniture = [](const SceneData& counted) {
+            bool hasSexualAction = std::any_of(counted.actions.begin(), counted.actions.end(),
+                [](const SceneActionData& a) { return kSexualActionTypes.count(a.type.str()) > 0; });
+            return hasSexualAction ? counted.furnitureType : Symbol{};
+        };
+        auto& furnitureDB = FurnitureDatabase::GetSingleton();
+        if (reload) {
+            auto previous = m_scenes.find(scene.id);
+            if (previous != m_scenes.end()) {
+                Symbol furniture = countedFurniture(previous->second);
+                if (!furniture.empty()) {
+                    furnitureDB.DecrementSceneCount(furniture.str());
+                }
+            }
+        }
+        if (Symbol furniture = countedFurniture(scene); !furniture.empty()) {
+            furnitureDB.IncrementSceneCount(furniture.str());
+        }
+
+        // Later files win on duplicate IDs, matching the serial overwrite behaviour.
+        // A reloaded or duplicate ID keeps the handle it already has.
+        std::string id = scene.id;
+        auto [it, inserted] = m_scenes.try_emplace(id);
+        const SceneHandle handle = inserted ? AcquireHandle() : it->second.handle;
+        it->second = std::move(scene);
+        it->second.handle = handle;
+        if (handle) {
+            m_slots[handle.Slot()].scene = &it->second;
+        }
+    }
+
+    SceneHandle SceneDatabase::AcquireHandle() {
+        if (!m_freeSlots.empty()) {
+            const uint32_t slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            return SceneHandle(slot, m_slots[slot].generation);
+        }
+        if (m_slots.size() >= SceneHandle::kMaxSlots) {
+            SKSE::log::error("SceneDatabase: out of scene handles ({} slots)", m_slots.size());
+            return {};
+        }
+        m_slots.emplace_back();
+        return SceneHandle(static_cast<uint32_t>(m_slots.size() - 1), m_slots.back().generation);
+    }
+
+    void SceneDatabase::RetireHandles() {
+        m_freeSlots.clear();
+        for (uint32_t slot = static_cast<uint32_t>(m_slots.size()); slot-- > 0;) {
+            Slot& entry = m_slots[slot];
+            entry.scene = nullptr;
+            entry.generation = entry.generation == 0xFF ? 1 : static_cast<uint8_t>(entry.generation + 1);
+            m_freeSlots.push_back(slot);
+        }
+    }
+
+    void SceneDatabase::RebuildColumns() {
+        ++m_catalogVersion;
+        m_columns.Build(m_scenes);
+        for (uint32_t i = 0; i < m_columns.Size(); ++i) {
+            if (SceneHandle handle = m_columns.scenes[i]->handle) {
+                m_slots[handle.Slot()].index = i;
+            }
+        }
+        m_indexes.Build(m_columns);
+        m_bitsets.Build(m_columns, m_indexes);
+        m_searchIndex.Build(m_columns, m_indexes);
+        if (!m_idTable.Build(m_columns)) {
+            SKSE::log::warn("SceneDatabase: could not build the scene ID table, falling back to hashed lookups");
+        }
+    }
+
+    namespace {
+        // Symbols are written as ids into a string table stored ahead of the
+        // scenes, so loading interns each distinct string once.
+        void WriteSymbolTable(SceneCatalogCache::BinaryWriter& writer) {
+            auto& table = SymbolTable::GetSingleton();
+            const uint32_t count = table.Size();
+            writer.U32(count);
+            for (uint32_t id = 0; id < count; ++id) {
+                writer.String(table.FromId(id)->str());
+            }
+        }
+
+        std::vector<Symbol> ReadSymbolTable(SceneCatalogCache::BinaryReader& reader) {
+            const uint32_t count = reader.Count(sizeof(uint32_t));
+            std::vector<Symbol> symbols;
+            symbols.reserve(count);
+            for (uint32_t i = 0; i < count && !reader.Failed(); ++i) {
+                symbols.push_back(Symbol::Intern(reader.StringView()));
+            }
+            return symbols;
+        }
+
+        void WriteSymbols(SceneCatalogCache::BinaryWriter& writer, std::span<const Symbol> symbols) {
+            writer.U32(static_cast<uint32_t>(symbols.size()));
+            for (Symbol symbol : symbols) {
+                writer.U32(symbol.Id());
+            }
+        }
+
+        Symbol ReadSymbol(SceneCatalogCache::BinaryReader& reader, const std::vector<Symbol>& symbols) {
+            const uint32_t index = reader.U32();
+            if (index >= symbols.size()) {
+                reader.Fail();
+                return {};
+            }
+            return symbols[index];
+        }
+
+        std::vector<Symbol> ReadSymbols(SceneCatalogCache::BinaryReader& reader, const std::vector<Symbol>& symbols) {
+            const uint32_t count = reader.Count(sizeof(uint32_t));
+            std::vector<Symbol> result;
+            result.reserve(count);
+            for (uint32_t i = 0; i < count && !reader.Failed(); ++i) {
+                result.push_back(ReadSymbol(reader, symbols));
+            }
+            return result;
+        }
+
+        void WriteScene(SceneCatalogCache::BinaryWriter& writer, const SceneData& scene) {
+            writer.String(scene.id);
+            writer.Path(scene.filePath);
+            writer.String(scene.name);
+            writer.U32(scene.modpack.Id());
+            writer.U32(scene.actorCount);
+            writer.U32(scene.furnitureType.Id());
+            WriteSymbols(writer, scene.tags);
+
+            writer.U32(static_cast<uint32_t>(scene.actions.size()));
+            for (const auto& action : scene.actions) {
+                writer.U32(action.type.Id());
+                writer.I8(action.actor);
+                writer.I8(action.target);
+                writer.I8(action.performer);
+            }
+
+            writer.U32(static_cast<uint32_t>(scene.actors.size()));
+            for (const auto& actor : scene.actors) {
+                writer.U32(actor.intendedSex.Id());
+                writer.I32(actor.animationIndex);
+                WriteSymbols(writer, actor.tags);
+            }
+
+            writer.F32(scene.length);
+            writer.Bool(scene.isTransition);
+            writer.String(scene.destination);
+            writer.Bool(scene.noRandomSelection);
+            writer.String(scene.firstSpeedAnimation);
+        }
+
+        void ReadScene(SceneCatalogCache::BinaryReader& reader, const std::vector<Symbol>& symbols, SceneData& scene) {
+            scene.id = reader.String();
+            scene.filePath = reader.Path();
+            scene.name = reader.String();
+            scene.modpack = ReadSymbol(reader, symbols);
+            scene.actorCount = reader.U32();
+            scene.furnitureType = ReadSymbol(reader, symbols);
+            scene.tags = ReadSymbols(reader, symbols);
+
+            const uint32_t actionCount = reader.Count(sizeof(uint32_t) + 3 * sizeof(int8_t));
+            scene.actions.reserve(actionCount);
+            for (uint32_t i = 0; i < actionCount && !reader.Failed(); ++i) {
+                SceneActionData& action = scene.actions.emplace_back();
+                action.type = ReadSymbol(reader, symbols);
+                action.actor = reader.I8();
+                action.target = reader.I8();
+                action.performer = reader.I8();
+            }
+
+            const uint32_t actorCount = reader.Count(2 * sizeof(uint32_t) + sizeof(int32_t));
+            scene.actors.reserve(actorCount);
+            for (uint32_t i = 0; i < actorCount && !reader.Failed(); ++i) {
+                ActorData& actor = scene.actors.emplace_back();
+                actor.intendedSex = ReadSymbol(reader, symbols);
+                actor.animationIndex = reader.I32();
+                actor.tags = SymbolList::Intern(ReadSymbols(reader, symbols));
+            }
+
+            scene.length = reader.F32();
+            scene.isTransition = reader.Bool();
+            scene.destination = reader.String();
+            scene.noRandomSelection = reader.Bool();
+            scene.firstSpeedAnimation = reader.String();
+        }
+    }
+
+    bool SceneDatabase::LoadSnapshot(const std::vector<SceneCatalogCache::FileStamp>& dependencies,
+                                     std::unordered_map<std::string, SceneFileEntry>& cached) const {
+        SceneCatalogCache::MappedFile file(SceneCatalogCache::kSnapshotPath);
+        if (!file.IsOpen()) {
+            SKSE::log::info("SceneDatabase: no scene snapshot found, parsing all scene files");
+            return false;
+        }
+
+        try {
+            SceneCatalogCache::BinaryReader reader(file.Data(), file.Size());
+            if (reader.U32() != kSnapshotMagic || reader.U32() != SceneCatalogCache::kFormatVersion) {
+                SKSE::log::info("SceneDatabase: scene snapshot has an old format, parsing all scene files");
+                return false;
+            }
+            if (reader.Stamps() != dependencies || reader.Failed()) {
+                SKSE::log::info("SceneDatabase: action or OStimNet metadata files changed, parsing all scene files");
+                return false;
+            }
+
+            const std::vector<Symbol> symbols = ReadSymbolTable(reader);
+            const uint32_t fileCount = reader.U32();
+            cached.reserve(fileCount);
+            for (uint32_t i = 0; i < fileCount && !reader.Failed(); ++i) {
+                SceneFileEntry entry;
+                entry.stamp = reader.Stamp();
+                entry.contentHash = reader.U64();
+                entry.parsed = reader.Bool();
+                if (entry.parsed) {
+                    ReadScene(reader, symbols, entry.scene);
+                    entry.path = entry.scene.filePath;
+                    entry.pendingTags = reader.Strings();
+                } else {
+                    entry.scene.id = reader.String();
+                    entry.partial.tags = ReadSymbols(reader, symbols);
+                    entry.partial.actions = ReadSymbols(reader, symbols);
+                    entry.partial.actorTags = ReadSymbols(reader, symbols);
+                    entry.partial.animation = reader.String();
+                }
+                std::string key = entry.stamp.path;
+                cached.emplace(std::move(key), std::move(entry));
+            }
+
+            if (reader.Failed() || !reader.AtEnd()) {
+                SKSE::log::warn("SceneDatabase: scene snapshot is corrupt, parsing all scene files");
+                cached.clear();
+                return false;
+            }
+            return true;
+        } catch (const std::exception& e) {
+            SKSE::log::warn("SceneDatabase: failed to read scene snapshot: {}", e.what());
+            cached.clear();
+            return false;
+        }
+    }
+
+    void SceneDatabase::SaveSnapshot(const std::vector<SceneFileEntry>& entries,
+                                     const std::vector<SceneCatalogCache::FileStamp>& dependencies) const {
+        try {
+            SceneCatalogCache::BinaryWriter writer;
+            writer.U32(kSnapshotMagic);
+            writer.U32(SceneCatalogCache::kFormatVersion);
+            writer.Stamps(dependencies);
+            WriteSymbolTable(writer);
+
+            writer.U32(static_cast<uint32_t>(entries.size()));
+            for (const auto& entry : entries) {
+                writer.Stamp(entry.stamp);
+                writer.U64(entry.contentHash);
+                writer.Bool(entry.parsed);
+                if (entry.parsed) {
+                    WriteScene(writer, entry.scene);
+                    writer.Strings(entry.pendingTags);
+                } else {
+                    writer.String(entry.scene.id);
+                    WriteSymbols(writer, entry.partial.tags);
+                    WriteSymbols(writer, entry.partial.actions);
+                    WriteSymbols(writer, entry.partial.actorTags);
+                    writer.String(entry.partial.animation);
+                }
+            }
+
+            if (writer.SaveTo(SceneCatalogCache::kSnapshotPath)) {
+                SKSE::log::info("SceneDatabase: wrote scene snapshot ({} KB)", writer.Buffer().size() / 1024);
+            }
+        } catch (const std::exception& e) {
+            SKSE::log::warn("SceneDatabase: failed to write scene snapshot: {}", e.what());
+        }
+    }
+
+    void SceneDatabase::UpdateBundle(const std::vector<SceneFileEntry>& entries, SceneBundle::Reader& bundle) const {
+        bool fresh = bundle.IsOpen() && bundle.Size() == entries.size();
+        for (size_t i = 0; fresh && i < entries.size(); ++i) {
+            fresh = bundle.Find(entries[i].stamp).has_value();
+        }
+        if (fresh) {
+            return;
+        }
+
+        try {
+            SceneBundle::Writer writer;
+            size_t readFromDisk = 0;
+            std::string content;
+            for (const auto& entry : entries) {
+                if (entry.contentLoaded) {
+                    writer.Add(entry.stamp, entry.content);
+                } else if (auto payload = bundle.Find(entry.stamp)) {
+                    writer.Add(entry.stamp, *payload);
+                } else if (JsonUtils::ReadFile(entry.path, content)) {
+                    // Taken from the snapshot but not bundled yet
+                    writer.Add(entry.stamp, content);
+                    ++readFromDisk;
+                }
+            }
+
+            // The old bundle is still mapped; it has to be released before it can be replaced.
+            bundle.Close();
+            if (writer.SaveTo(SceneBundle::kBundlePath)) {
+                SKSE::log::info("SceneDatabase: wrote scene bundle ({} files, {} read from disk)",
+                    writer.Size(), readFromDisk);
+            }
+        } catch (const std::exception& e) {
+            SKSE::log::warn("SceneDatabase: failed to write scene bundle: {}", e.what());
+        }
+    }
+
+    const char* SceneDatabase::LoadStateName(LoadState state) {
+        switch (state) {
+        case LoadState::Loading: return "loading";
+        case LoadState::Ready:   return "ready";
+        case LoadState::Failed:  return "failed";
+        default:                 return "not loaded";
+        }
+    }
+
+    SceneData* SceneDatabase::GetSceneByID(std::string_view id) {
+        // The frozen table covers the whole catalog once it is built; the map
+        // serves lookups while loading
+        if (!m_idTable.Empty()) {
+            auto index = m_idTable.Find(id, m_columns);
+            return index ? m_columns.scenes[*index] : nullptr;
+        }
+        auto it = m_scenes.find(id);
         if (it != m_scenes.end()) {
             return &it->second;
         }
         return nullptr;
     }
 
+    SceneHandle SceneDatabase::GetHandle(std::string_view id) {
+        SceneData* scene = GetSceneByID(id);
+        return scene ? scene->handle : SceneHandle{};
+    }
+
     std::vector<SceneData*> SceneDatabase::GetAllScenes() {
-        std::vector<SceneData*> result;
-        result.reserve(m_scenes.size());
-        for (auto& pair : m_scenes) {
-            result.push_back(&pair.second);
-        }
-        return result;
+        return m_columns.scenes;
     }
 
     std::vector<SceneData*> SceneDatabase::GetScenesByActorCount(uint32_t actorCount) {
-        return FilterScenes([actorCount](const SceneData& scene) {
-            return scene.actorCount == actorCount;
-        });
+        return ResolveIndices(SceneIndexes::Find(m_indexes.actorCounts, actorCount));
     }
 
     std::vector<SceneData*> SceneDatabase::GetScenesByTag(const std::string& tag) {
-        std::string lowerTag = StringUtils::ToLowerCopy(tag);
-        return FilterScenes([&lowerTag](const SceneData& scene) {
-            return std::find(scene.tags.begin(), scene.tags.end(), lowerTag) != scene.tags.end();
-        });
+        auto symbol = Symbol::Find(StringUtils::ToLowerCopy(tag));
+        if (!symbol) {
+            return {};
+        }
+        return ResolveIndices(SceneIndexes::Find(m_indexes.sceneTags, *symbol));
     }
 
     std::vector<SceneData*> SceneDatabase::SearchScenesByName(const std::string& searchTerm) {
-        std::string lowerSearch = StringUtils::ToLowerCopy(searchTerm);
-        return FilterScenes([&lowerSearch](const SceneData& scene) {
-            return StringUtils::ToLowerCopy(scene.name).find(lowerSearch) != std::string::npos;
-        });
+        return ResolveIndices(m_searchIndex.Search(searchTerm, false));
     }
 
     std::vector<std::string> SceneDatabase::GetAllTags() const {
-        return StringUtils::SetToSortedVector(m_allTags);
+        return ToSortedStrings(m_allTags);
     }
 
     std::vector<std::string> SceneDatabase::GetAllActions() const {
-        return StringUtils::SetToSortedVector(m_allActions);
+        return ToSortedStrings(m_allActions);
     }
 
     std::vector<std::string> SceneDatabase::GetAllActorTags() const {
-        return StringUtils::SetToSortedVector(m_allActorTags);
+        return ToSortedStrings(m_allActorTags);
     }
 
     std::vector<std::string> SceneDatabase::GetAllPositions() const {
-        return StringUtils::SetToSortedVector(m_allPositions);
+        return ToSortedStrings(m_allPositions);
     }
 
     void SceneDatabase::ReloadSceneFromContent(const std::string& id, const std::string& content,
@@ -399,60 +893,69 @@ namespace OStimNavigator {
         std::string lowerID = id;
         std::transform(lowerID.begin(), lowerID.end(), lowerID.begin(), ::tolower);
 
+        SceneFileEntry entry;
+        entry.scene.id = lowerID;
         try {
-            nlohmann::ordered_json j = nlohmann::ordered_json::parse(content);
+            SceneJson::SceneFields fields;
+            SceneJson::Read(content, fields);
+            if (!fields.isObject) {
+                throw std::runtime_error("scene file is not a JSON object");
+            }
 
             SceneData scene;
             scene.id       = lowerID;
             scene.filePath = filePath;
 
-            scene.name              = j.value("name", scene.id);
-            scene.modpack           = j.contains("modpack") ? j.value("modpack", "") : j.value("modPack", "");
-            scene.length            = j.value("length", 0.0f);
-            scene.noRandomSelection = j.value("noRandomSelection", false);
-            scene.furnitureType     = j.value("furniture", "");
+            scene.name              = fields.name.Has() ? SceneJson::AsString(fields.name, "name") : scene.id;
+            scene.modpack           = Symbol::Intern(fields.modpack.Has() ? SceneJson::AsString(fields.modpack, "modpack")
+                                    : fields.modPack.Has() ? SceneJson::AsString(fields.modPack, "modPack") : "");
+            scene.length            = fields.length.Has() ? SceneJson::AsFloat(fields.length, "length") : 0.0f;
+            scene.noRandomSelection = fields.noRandomSelection.Has() && SceneJson::AsBool(fields.noRandomSelection, "noRandomSelection");
+            scene.furnitureType     = Symbol::Intern(fields.furniture.Has() ? SceneJson::AsString(fields.furniture, "furniture") : "");
 
-            if (j.contains("destination")) {
+            if (fields.destination.Has()) {
                 scene.isTransition = true;
-                scene.destination  = j["destination"].get<std::string>();
+                scene.destination  = SceneJson::AsString(fields.destination, "destination");
             }
 
             // Parse speeds[0].animation -> scene.firstSpeedAnimation
-            if (j.contains("speeds") && j["speeds"].is_array() && !j["speeds"].empty()) {
-                const auto& speedObj = j["speeds"][0];
-                if (speedObj.contains("animation") && speedObj["animation"].is_string()) {
-                    scene.firstSpeedAnimation = speedObj["animation"].get<std::string>();
-                }
+            if (fields.speeds.IsArray() && fields.speedCount > 0 && fields.firstSpeed.IsObject() &&
+                fields.firstSpeedAnimation.IsString()) {
+                scene.firstSpeedAnimation = fields.firstSpeedAnimation.string;
             }
 
-            ParseActors(j, scene);
+            ParseActors(fields, scene, entry.partial);
 
-            if (j.contains("tags") && j["tags"].is_array()) {
-                for (const auto& tag : j["tags"]) {
-                    std::string tagStr = tag.get<std::string>();
+            if (fields.tags.IsArray()) {
+                for (const auto& tag : fields.tagValues) {
+                    std::string tagStr = SceneJson::AsString(tag, "tags");
                     StringUtils::ToLower(tagStr);
-                    scene.tags.push_back(tagStr);
-                    m_allTags.insert(tagStr);
+                    Symbol tagSymbol = Symbol::Intern(tagStr);
+                    scene.tags.push_back(tagSymbol);
+                    entry.partial.tags.push_back(tagSymbol);
                 }
             }
 
-            ParseActions(j, scene);
+            ParseActions(fields, scene, entry.partial);
 
             // OStimNet metadata re-injection is intentionally skipped here — it was
             // already applied during the initial LoadScenes() pass and must not run
             // again during a hot-reload triggered by a user edit.
 
-            m_scenes[lowerID] = std::move(scene);
+            entry.scene = std::move(scene);
+            entry.parsed = true;
+            entry.partial = {};
+            MergeEntry(entry, true);
+            RebuildColumns();
             SKSE::log::info("SceneDatabase::ReloadSceneFromContent: refreshed '{}'", id);
         } catch (const std::exception& e) {
             SKSE::log::error("SceneDatabase::ReloadSceneFromContent: parse failed for '{}': {}", id, e.what());
+            MergeEntry(entry, true);
         }
     }
 
-    std::filesystem::path SceneDatabase::FindSceneFilePath(const std::string& id) const {
-        std::string lowerID = id;
-        std::transform(lowerID.begin(), lowerID.end(), lowerID.begin(), ::tolower);
-        auto it = m_scenes.find(lowerID);
+    std::filesystem::path SceneDatabase::FindSceneFilePath(std::string_view id) const {
+        auto it = m_scenes.find(id);
         if (it != m_scenes.end()) {
             return it->second.filePath;
         }
@@ -1,35 +1,61 @@
 #pragma once
 
 #include "PCH.h"
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include <nlohmann/json.hpp>
+#include "ActionDatabase.h"
+#include "SceneBitsets.h"
+#include "SceneBundle.h"
+#include "SceneCatalogCache.h"
+#include "SceneHandle.h"
+#include "SceneIdTable.h"
+#include "SceneIndex.h"
+#include "SceneJson.h"
+#include "SceneSearchIndex.h"
+#include "StringUtils.h"
+#include "SymbolTable.h"
 
 namespace OStimNavigator {
     
+    // Actor and action records are small, trivially copyable values: strings
+    // are symbols, an actor's tags are an interned list shared by every actor
+    // with the same tags, and role indices fit in a byte.
     struct ActorData {
-        std::string intendedSex;                // "male", "female", or empty for any
-        int animationIndex = -1;                // Animation index, -1 if not specified
-        std::vector<std::string> tags;          // Actor tags
+        Symbol intendedSex;                     // "male", "female", or empty for any
+        int32_t animationIndex = -1;            // Animation index, -1 if not specified
+        SymbolList tags;                        // Actor tags
     };
     
     struct SceneActionData {
-        std::string type;                       // Action type (resolved)
-        int actor = -1;                         // Actor role index (-1 if not specified)
-        int target = -1;                        // Target role index (-1 if not specified)
-        int performer = -1;                     // Performer role index (-1 if not specified)
+        Symbol type;                            // Action type (resolved)
+        int8_t actor = -1;                      // Actor role index (-1 if not specified)
+        int8_t target = -1;                     // Target role index (-1 if not specified)
+        int8_t performer = -1;                  // Performer role index (-1 if not specified)
+
+        // Scenes have far fewer than 127 actors, so a role index outside int8_t
+        // names no actor either way; clamping keeps its sign.
+        static int8_t ToRole(int index) { return static_cast<int8_t>(std::clamp(index, -128, 127)); }
     };
+
+    static_assert(std::is_trivially_copyable_v<ActorData> && sizeof(ActorData) == 12);
+    static_assert(std::is_trivially_copyable_v<SceneActionData> && sizeof(SceneActionData) == 8);
     
     struct SceneData {
         std::string id;                         // Scene ID (filename without .json)
         std::filesystem::path filePath;         // Absolute path to the source .json file
         std::string name;                       // Display name
-        std::string modpack;                    // Modpack name
+        Symbol modpack;                         // Modpack name
         uint32_t actorCount = 0;                // Number of actors
-        std::string furnitureType;              // Furniture type
-        std::vector<std::string> tags;          // Scene tags
+        Symbol furnitureType;                   // Furniture type
+        std::vector<Symbol> tags;               // Scene tags
         std::vector<SceneActionData> actions;   // Actions with role mappings
         std::vector<ActorData> actors;          // Actor data for each position
 
@@ -39,6 +65,84 @@ namespace OStimNavigator {
         std::string destination;                // Transition destination (if transition)
         bool noRandomSelection = false;         // If true, not suitable for auto mode
         std::string firstSpeedAnimation;        // First speed animation name
+
+        SceneHandle handle;                     // Assigned by SceneDatabase when merged
+    };
+
+    // Scenes keyed by lowercase ID; find() takes any case and any string type
+    using SceneCatalog = StringUtils::CaseInsensitiveMap<SceneData>;
+
+    // Structure-of-arrays copy of the catalog for filter and ranking scans.
+    // Scenes get dense indices in ID order. Per-scene lists are flattened into
+    // shared arrays, and scene i owns [offsets[i], offsets[i + 1]) of each.
+    // Rebuilt by SceneDatabase whenever the catalog changes.
+    struct SceneColumns {
+        enum SceneFlag : uint8_t {
+            kTransition         = 1 << 0,
+            kNoRandomSelection  = 1 << 1,
+            kIntroOrIdle        = 1 << 2,       // Has an "intro" or "idle" tag (any case)
+        };
+
+        enum ActionCategory : uint8_t {
+            kSexual             = 1 << 0,       // Action carries the "sexual" tag
+            kSensual            = 1 << 1,
+            kRomantic           = 1 << 2,
+        };
+
+        std::vector<SceneData*> scenes;         // Index -> scene
+        std::vector<uint32_t> actorCount;
+        std::vector<uint8_t> flags;             // SceneFlag bits
+        std::vector<Symbol> furnitureType;
+        std::vector<Symbol> modpack;
+
+        std::vector<uint32_t> tagOffsets;
+        std::vector<Symbol> tags;
+
+        std::vector<uint32_t> actionOffsets;
+        std::vector<SceneActionData> actions;
+        std::vector<uint8_t> actionCategories;  // ActionCategory bits, parallel to actions
+
+        // What each actor slot must offer: the union of the role requirements
+        // of every action that puts the slot in that role. Scene i owns slots
+        // [requirementOffsets[i], requirementOffsets[i + 1]) up to the last one
+        // with requirements (none for most scenes); each slot's mask is
+        // requirementStride words of requirementWords.
+        std::vector<uint32_t> requirementOffsets;
+        std::vector<uint64_t> requirementWords;
+        uint32_t requirementStride = 0;         // ActionDatabase::RequirementWords()
+
+        // Actors are numbered across the whole catalog; scene i owns
+        // [actorOffsets[i], actorOffsets[i + 1]).
+        std::vector<uint32_t> actorOffsets;
+        std::vector<Symbol> actorSex;           // Lowercase intendedSex
+        std::vector<uint32_t> actorPositions;   // Position tag mask (see SceneSimilarity)
+        std::vector<uint32_t> actorTagOffsets;
+        std::vector<Symbol> actorTags;
+
+        void Build(SceneCatalog& catalog);
+
+        uint32_t Size() const { return static_cast<uint32_t>(scenes.size()); }
+
+        // Dense index of a catalog scene, or nullopt if it is not in the catalog
+        std::optional<uint32_t> IndexOf(const SceneData* scene) const;
+
+        std::span<const Symbol> Tags(uint32_t i) const {
+            return { tags.data() + tagOffsets[i], tags.data() + tagOffsets[i + 1] };
+        }
+        std::span<const SceneActionData> Actions(uint32_t i) const {
+            return { actions.data() + actionOffsets[i], actions.data() + actionOffsets[i + 1] };
+        }
+        std::span<const uint8_t> ActionCategories(uint32_t i) const {
+            return { actionCategories.data() + actionOffsets[i], actionCategories.data() + actionOffsets[i + 1] };
+        }
+        // Scene i's per-slot masks, back to back
+        std::span<const uint64_t> RequirementMasks(uint32_t i) const {
+            return { requirementWords.data() + static_cast<size_t>(requirementOffsets[i]) * requirementStride,
+                     requirementWords.data() + static_cast<size_t>(requirementOffsets[i + 1]) * requirementStride };
+        }
+        std::span<const Symbol> ActorTags(uint32_t actor) const {
+            return { actorTags.data() + actorTagOffsets[actor], actorTags.data() + actorTagOffsets[actor + 1] };
+        }
     };
 
     class SceneDatabase {
@@ -65,8 +169,38 @@ namespace OStimNavigator {
                                     const std::filesystem::path& filePath);
 
         // Query functions
-        SceneData* GetSceneByID(const std::string& id);
-        std::vector<SceneData*> GetAllScenes();
+        // Case-insensitive; does not allocate
+        SceneData* GetSceneByID(std::string_view id);
+
+        // Stable handle for a scene ID (case-insensitive), or an invalid handle.
+        // Look it up once and keep the handle instead of the ID or a pointer.
+        SceneHandle GetHandle(std::string_view id);
+
+        // O(1). nullptr for an invalid handle or one from an earlier catalog.
+        SceneData* Resolve(SceneHandle handle) const {
+            if (handle.Slot() >= m_slots.size()) {
+                return nullptr;
+            }
+            const Slot& slot = m_slots[handle.Slot()];
+            return slot.generation == handle.Generation() ? slot.scene : nullptr;
+        }
+
+        // SceneColumns index of a handle's scene
+        std::optional<uint32_t> IndexOf(SceneHandle handle) const {
+            if (!Resolve(handle)) {
+                return std::nullopt;
+            }
+            return m_slots[handle.Slot()].index;
+        }
+
+        std::vector<SceneData*> GetAllScenes();      // In ID order
+        const SceneColumns& GetColumns() const { return m_columns; }
+        const SceneIndexes& GetIndexes() const { return m_indexes; }
+        const SceneBitsets& GetBitsets() const { return m_bitsets; }
+        const SceneSearchIndex& GetSearchIndex() const { return m_searchIndex; }
+
+        // Changes whenever the columns are rebuilt, which renumbers the scenes
+        uint32_t GetCatalogVersion() const { return m_catalogVersion; }
         std::vector<SceneData*> GetScenesByActorCount(uint32_t actorCount);
         std::vector<SceneData*> GetScenesByTag(const std::string& tag);
         std::vector<SceneData*> SearchScenesByName(const std::string& searchTerm);
@@ -76,7 +210,15 @@ namespace OStimNavigator {
         
         // Stats
         size_t GetSceneCount() const { return m_scenes.size(); }
-        bool IsLoaded() const { return m_loaded; }
+
+        // Catalog readiness, set by CatalogLoader. The catalog may be built on
+        // background threads, so nothing may read this or any other database
+        // unless the state is Ready.
+        enum class LoadState : uint8_t { NotLoaded, Loading, Ready, Failed };
+        LoadState GetLoadState() const { return m_state.load(std::memory_order_acquire); }
+        bool IsReady() const { return GetLoadState() == LoadState::Ready; }
+        void SetLoadState(LoadState state) { m_state.store(state, std::memory_order_release); }
+        static const char* LoadStateName(LoadState state);
         
         // Get all unique tags from all scenes
         std::vector<std::string> GetAllTags() const;
@@ -91,7 +233,7 @@ namespace OStimNavigator {
         std::vector<std::string> GetAllPositions() const;
 
         // Find the filesystem path for a scene by ID (empty path if not found)
-        std::filesystem::path FindSceneFilePath(const std::string& id) const;
+        std::filesystem::path FindSceneFilePath(std::string_view id) const;
 
     private:
         SceneDatabase() = default;
@@ -99,27 +241,92 @@ namespace OStimNavigator {
         SceneDatabase(const SceneDatabase&) = delete;
         SceneDatabase& operator=(const SceneDatabase&) = delete;
 
-        void ParseSceneFile(const std::filesystem::path& filePath);
-        void ParseActors(const nlohmann::json& j, SceneData& scene);
-        void ParseActions(const nlohmann::json& j, SceneData& scene);
+        // Everything one scene file contributes to the catalog. Parsing never
+        // touches the database members directly; entries are merged on the
+        // calling thread in file enumeration order, so a parallel or partially
+        // cached load matches a serial one exactly.
+        struct SceneFileEntry {
+            std::filesystem::path path;
+            SceneCatalogCache::FileStamp stamp;
+            uint64_t contentHash = 0;               // Hash of the file as last read or written
+            bool parsed = false;                    // scene holds a successfully parsed scene
+            bool contentLoaded = false;             // content holds the file's bytes
+            std::string content;                    // Raw file as last read or written (for the bundle)
+            SceneData scene;
+
+            // OStimNet tags the file itself still lacks. Kept in the snapshot so a
+            // write-back cut short by the game exiting is queued again next load.
+            std::vector<std::string> pendingTags;
+
+            // What a failed parse had already registered before it threw. A serial
+            // load keeps these in the global sets, so they are preserved as well.
+            // Cleared on success, where everything is derived from the scene.
+            struct Partial {
+                std::vector<Symbol> tags;
+                std::vector<Symbol> actions;
+                std::vector<Symbol> actorTags;
+                std::string animation;              // Lowercase first-speed animation mapped to scene.id
+            } partial;
+        };
+
+        void ParseSceneFile(SceneFileEntry& entry);
+        void ParseActors(const SceneJson::SceneFields& fields, SceneData& scene, SceneFileEntry::Partial& partial);
+        void ParseActions(const SceneJson::SceneFields& fields, SceneData& scene, SceneFileEntry::Partial& partial);
+
+        // Apply one entry to the catalog. A hot reload replaces the scene's
+        // furniture scene count contribution instead of adding a second one.
+        void MergeEntry(SceneFileEntry& entry, bool reload = false);
+
+        // Rebuild the columnar store and everything derived from it after the scenes changed.
+        void RebuildColumns();
+
+        // Handle slots. A slot belongs to one scene ID until RetireHandles, which
+        // bumps every generation and frees the slots for the next catalog.
+        struct Slot {
+            SceneData* scene = nullptr;
+            uint32_t index = 0;                     // SceneColumns index, set by RebuildColumns
+            uint8_t generation = 1;                 // Never 0, which marks invalid handles
+        };
+
+        SceneHandle AcquireHandle();
+        void RetireHandles();
+
+        // Binary snapshot of the parsed catalog (see SceneCatalogCache.h).
+        // LoadSnapshot returns the cached entries keyed by UTF-8 path, or false if
+        // there is no usable snapshot for the given dependency stamps.
+        bool LoadSnapshot(const std::vector<SceneCatalogCache::FileStamp>& dependencies,
+                          std::unordered_map<std::string, SceneFileEntry>& cached) const;
+        void SaveSnapshot(const std::vector<SceneFileEntry>& entries,
+                          const std::vector<SceneCatalogCache::FileStamp>& dependencies) const;
+
+        // Rewrite the scene bundle (see SceneBundle.h) if it no longer matches the
+        // enumerated files. Payloads come from the entries, the old bundle, or disk.
+        void UpdateBundle(const std::vector<SceneFileEntry>& entries, SceneBundle::Reader& bundle) const;
         
-        template<typename Predicate>
-        std::vector<SceneData*> FilterScenes(Predicate pred) {
+        std::vector<SceneData*> ResolveIndices(const PostingList& indices) const {
             std::vector<SceneData*> result;
-            for (auto& pair : m_scenes) {
-                if (pred(pair.second)) {
-                    result.push_back(&pair.second);
-                }
+            result.reserve(indices.size());
+            for (uint32_t index : indices) {
+                result.push_back(m_columns.scenes[index]);
             }
             return result;
         }
 
-        std::unordered_map<std::string, SceneData> m_scenes;
-        std::unordered_set<std::string> m_allTags;
-        std::unordered_set<std::string> m_allActions;
-        std::unordered_set<std::string> m_allActorTags;
-        std::unordered_set<std::string> m_allPositions;
+        SceneCatalog m_scenes;
+        std::unordered_set<Symbol> m_allTags;
+        std::unordered_set<Symbol> m_allActions;
+        std::unordered_set<Symbol> m_allActorTags;
+        std::unordered_set<Symbol> m_allPositions;
         std::unordered_map<std::string, std::string> m_animationToOStimSceneId;
+        SceneColumns m_columns;
+        SceneIndexes m_indexes;
+        SceneBitsets m_bitsets;
+        SceneSearchIndex m_searchIndex;
+        SceneIdTable m_idTable;
+        std::vector<Slot> m_slots;
+        std::vector<uint32_t> m_freeSlots;          // Retired slots, lowest last
+        uint32_t m_catalogVersion = 0;
         bool m_loaded = false;
+        std::atomic<LoadState> m_state = LoadState::NotLoaded;
     };
 }
@@ -1,9 +1,6 @@
 #include "SceneDescriptionBuilder.h"
 #include "SceneDescriptionData.h"
 #include "ActionDatabase.h"
-#include "FurnitureDatabase.h"
-#include "FormUtils.h"
-#include "OStimIntegration.h"
 #include "OStimNetMetaData.h"
 #include <sstream>
 #include <algorithm>
@@ -28,36 +25,25 @@ std::string ActorRef(int idx) {
 std::string FirstBodyPart(const std::unordered_set<std::string>& reqs) {
     for (const auto& p : kBodyPartPriority) {
         if (reqs.count(p)) {
-            return kBodyPartLabels.at(p);
+            return std::string(kBodyPartLabels.at(p));
         }
     }
     // Fallback: any labelled part
     for (const auto& r : reqs) {
         auto it = kBodyPartLabels.find(r);
-        if (it != kBodyPartLabels.end()) return it->second;
+        if (it != kBodyPartLabels.end()) return std::string(it->second);
     }
     return "";
 }
 
-// ─── Schlongified faction check ──────────────────────────────────────────────
-// Returns true if the actor is in OStim's schlongified faction (has a real penis).
-// Faction: OStim.esp 0xE9C
-
-bool IsSchlongified(RE::Actor* actor) {
-    if (!actor) return false;
-    static RE::TESFaction* s_faction = FormUtils::LookupForm<RE::TESFaction>(0xE9C, "OStim.esp");
-    if (!s_faction) return false;
-    return actor->IsInFaction(s_faction);
-}
-
 // ─── Organ resolution ─────────────────────────────────────────────────────────
 // If the named organ is "penis" or "testicles" but the actor is female and not
 // schlongified, they must be using a strapon — substitute accordingly.
 
-std::string ResolveOrgan(const std::string& organ, RE::Actor* actor) {
+std::string ResolveOrgan(const std::string& organ, const ThreadActor* actor) {
     if (organ != "penis" && organ != "testicles") return organ;
     if (!actor) return organ;
-    if (actor->GetActorBase()->GetSex() == RE::SEXES::kFemale && !IsSchlongified(actor)) {
+    if (actor->isFemale && !actor->schlongified) {
         return "strapon";
     }
     return organ;
@@ -67,7 +53,7 @@ std::string ResolveOrgan(const std::string& organ, RE::Actor* actor) {
 
 std::string GetVerbPhrase(const std::string& type, ActionDatabase& db) {
     const ActionPhrase* phrase = db.FindActionPhrase(type);
-    return phrase ? phrase->verbPhrase : type;
+    return phrase ? std::string(phrase->verbPhrase) : type;
 }
 
 // ─── Classify action into output tier ─────────────────────────────────────
@@ -85,29 +71,30 @@ int ClassifyAction(const std::string& type, ActionDatabase& db) {
 // ─── Decide whether an action targets the actor themselves ─────────────────
 
 bool IsSelfAction(const SceneActionData& action) {
-    return kSelfActionTypes.count(action.type) > 0
+    return kSelfActionTypes.count(action.type.str()) > 0
         || action.target < 0
         || action.target == action.actor;
 }
 
 // ─── Build the sentence for a single action ────────────────────────────────
 
-std::string BuildActionSentence(const SceneActionData& action, ActionDatabase& db, uint32_t threadID, int actorCount = 0) {
+std::string BuildActionSentence(const SceneActionData& action, ActionDatabase& db, const ThreadContext& thread, int actorCount = 0) {
     if (action.actor < 0) return "";
 
+    const std::string& type = action.type.str();
     std::string actorRef  = ActorRef(action.actor);
-    std::string verbPhrase = GetVerbPhrase(action.type, db);
+    std::string verbPhrase = GetVerbPhrase(type, db);
 
     // Fetch body-part info for context (only used for sexual tier).
     // kActionPhrases is authoritative; ActionDatabase JSON is the fallback.
     std::string actorPart, targetPart;
-    if (ClassifyAction(action.type, db) == 1) {
-        const ActionPhrase* phrase = db.FindActionPhrase(action.type);
+    if (ClassifyAction(type, db) == 1) {
+        const ActionPhrase* phrase = db.FindActionPhrase(type);
         if (phrase) {
             actorPart  = phrase->actorOrgan;
             targetPart = phrase->targetOrgan;
         } else {
-            const ActionData* data = db.GetAction(action.type);
+            const ActionData* data = db.GetAction(type);
             if (data) {
                 actorPart  = FirstBodyPart(data->actorRequirements);
                 targetPart = FirstBodyPart(data->targetRequirements);
@@ -116,22 +103,18 @@ std::string BuildActionSentence(const SceneActionData& action, ActionDatabase& d
 
         // Strapon/futa resolution: replace "penis"/"testicles" with "strapon" for
         // female actors who are not schlongified (futa).
-        RE::Actor* actorRE  = OStimIntegration::GetSingleton().GetActorFromThread(threadID, static_cast<uint32_t>(action.actor));
-        RE::Actor* targetRE = (action.target >= 0)
-            ? OStimIntegration::GetSingleton().GetActorFromThread(threadID, static_cast<uint32_t>(action.target))
-            : nullptr;
-        actorPart  = ResolveOrgan(actorPart,  actorRE);
-        targetPart = ResolveOrgan(targetPart, targetRE);
+        actorPart  = ResolveOrgan(actorPart,  thread.Actor(action.actor));
+        targetPart = ResolveOrgan(targetPart, thread.Actor(action.target));
     }
 
     std::string sentence;
 
     // Two-sided: render as "{{A}} and {{T}} [mutualVerb]" — no actor→target directionality.
     // Guard: if actor and target are the same person, fall through to self-action rendering.
-    if (!IsSelfAction(action) && action.actor != action.target && kTwoSidedActionTypes.count(action.type)) {
+    if (!IsSelfAction(action) && action.actor != action.target && kTwoSidedActionTypes.count(type)) {
         std::string targetRef = ActorRef(action.target);
-        auto it = kMutualVerbPhrases.find(action.type);
-        std::string mutualVerb = (it != kMutualVerbPhrases.end()) ? it->second : verbPhrase;
+        auto it = kMutualVerbPhrases.find(type);
+        std::string mutualVerb = (it != kMutualVerbPhrases.end()) ? std::string(it->second) : verbPhrase;
         return actorRef + " and " + targetRef + " " + mutualVerb;
     }
 
@@ -244,10 +227,10 @@ std::string PositionSentence(const std::vector<std::string>& rawPositions) {
         if (key == "idle") continue;
         // Common name — colloquial override or fall back to canonical key
         auto commonIt = kPositionCommonNames.find(key);
-        std::string commonName = (commonIt != kPositionCommonNames.end()) ? commonIt->second : key;
+        std::string commonName = (commonIt != kPositionCommonNames.end()) ? std::string(commonIt->second) : key;
         // Description — parenthetical annotation appended after "position"
         auto descIt = kPositionDisplayNames.find(key);
-        std::string desc = (descIt != kPositionDisplayNames.end()) ? descIt->second : "";
+        std::string desc = (descIt != kPositionDisplayNames.end()) ? std::string(descIt->second) : "";
         entries.push_back({commonName, desc});
     }
 
@@ -276,7 +259,7 @@ std::string PositionSentence(const std::vector<std::string>& rawPositions) {
 
 // ─── Public entry point ────────────────────────────────────────────────────
 
-std::string BuildSceneDescription(const SceneData& scene, uint32_t threadID) {
+std::string BuildSceneDescription(const SceneData& scene, const ThreadContext& thread) {
     auto& db = ActionDatabase::GetSingleton();
 
     std::ostringstream out;
@@ -290,12 +273,7 @@ std::string BuildSceneDescription(const SceneData& scene, uint32_t threadID) {
 
     // 1. Furniture intro — resolved from actor 0's faction membership.
     {
-        RE::Actor* actor = OStimIntegration::GetSingleton().GetActorFromThread(threadID, 0);
-        std::string furnitureType;
-        if (actor) {
-            furnitureType = FurnitureDatabase::GetSingleton().GetFurnitureTypeFromActor(actor);
-        }
-        std::string sentence = FurnitureSentence(furnitureType);
+        std::string sentence = FurnitureSentence(thread.furnitureType);
         if (!sentence.empty()) emit(sentence);
     }
 
@@ -328,20 +306,18 @@ std::string BuildSceneDescription(const SceneData& scene, uint32_t threadID) {
                 desc += token;
             };
 
-            RE::Actor* reActor = OStimIntegration::GetSingleton().GetActorFromThread(threadID, static_cast<uint32_t>(i));
-            if (reActor) {
-                auto sex = reActor->GetActorBase()->GetSex();
-                if (sex == RE::SEXES::kMale) append("male");
-                else if (sex == RE::SEXES::kFemale) append(IsSchlongified(reActor) ? "futa" : "female");
+            if (const ThreadActor* reActor = thread.Actor(i)) {
+                if (reActor->isMale) append("male");
+                else if (reActor->isFemale) append(reActor->schlongified ? "futa" : "female");
             } else if (!actor.intendedSex.empty()) {
-                append(actor.intendedSex);
+                append(actor.intendedSex.str());
             }
 
             bool isClimaxing = false;
-            for (const auto& tag : actor.tags) {
-                if (tag == "climaxing") { isClimaxing = true; continue; }
-                auto it = kActorTagLabels.find(tag);
-                if (it != kActorTagLabels.end()) append(it->second);
+            for (Symbol tag : actor.tags) {
+                if (tag.view() == "climaxing") { isClimaxing = true; continue; }
+                auto it = kActorTagLabels.find(tag.str());
+                if (it != kActorTagLabels.end()) append(std::string(it->second));
             }
             if (isClimaxing) climaxingActors.push_back(i);
 
@@ -378,12 +354,12 @@ std::string BuildSceneDescription(const SceneData& scene, uint32_t threadID) {
 
         // Resolve aliases (e.g. "anal" → "analsex") so lookups always hit
         SceneActionData resolved = action;
-        resolved.type = db.ResolveActionType(action.type);
+        resolved.type = Symbol::Intern(db.ResolveActionType(action.type.str()));
 
-        std::string sentence = BuildActionSentence(resolved, db, threadID, static_cast<int>(scene.actors.size()));
+        std::string sentence = BuildActionSentence(resolved, db, thread, static_cast<int>(scene.actors.size()));
         if (sentence.empty()) continue;
 
-        switch (ClassifyAction(resolved.type, db)) {
+        switch (ClassifyAction(resolved.type.str(), db)) {
             case 1: sexual.push_back(sentence);      break;
             case 2: sensual.push_back(sentence);     break;
             default: supporting.push_back(sentence); break;
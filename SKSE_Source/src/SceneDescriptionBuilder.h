@@ -2,6 +2,7 @@
 
 #include "PCH.h"
 #include "SceneDatabase.h"
+#include "ThreadContext.h"
 #include <string>
 
 namespace OStimNavigator {
@@ -9,7 +10,8 @@ namespace OStimNavigator {
     // Builds a human-readable scene description string from a SceneData.
     // Actor references use the template form {{scenedata.actors.N}}.
     //
-    // threadID: the OStim thread to fetch actors from for furniture type detection.
-    std::string BuildSceneDescription(const SceneData& scene, uint32_t threadID);
+    // thread: a snapshot of the OStim thread whose actors decide sex, strapon/futa
+    // wording and the furniture intro.
+    std::string BuildSceneDescription(const SceneData& scene, const ThreadContext& thread);
 
 }
@@ -3,12 +3,14 @@
 // kPositions is the authoritative canonical list — external consumers access it
 // via ONavGetCanonicalPositions(). The remaining tables are internal-only.
 #include "OStimNavigator_PublicAPI.h"
+#include "FrozenTable.h"
+#include <string_view>
 
 namespace OStimNavigatorAPI {
 
 // ─── Canonical scene position names ─────────────────────────────────────────
 
-inline const std::vector<std::string> kPositions = {
+inline constexpr auto kPositions = std::to_array<std::string_view>({
     // missionary family — receiver on back, giver on top/front
     "missionary",       // giver on top, face-to-face
     "butterfly",        // receiver on back, hips tilted up and legs spread, giver kneeling — body stays grounded, angle deepened
@@ -45,12 +47,12 @@ inline const std::vector<std::string> kPositions = {
     // special
     "wheelbarrow",      // receiver's legs held up by giver, hands on ground
     "idle",             // non-sexual / resting pose
-};
+});
 
 // ─── Alias → canonical position name ───────────────────────────────────────────
 // External consumers use ONavGetPositionAliases(); this table is the internal authority.
 
-inline const std::unordered_map<std::string, std::string> kPositionAliases = {
+inline constexpr auto kPositionAliases = ::OStimNavigator::MakeFrozenMap<std::string_view>({
     // missionary family
     { "mating-press",     "matingpress"    },
     { "mating press",     "matingpress"    },
@@ -94,12 +96,12 @@ inline const std::unordered_map<std::string, std::string> kPositionAliases = {
     { "wheel-barrow",     "wheelbarrow"    },
     { "rest",             "idle"           },
     { "resting",          "idle"           },
-};
+});
 
 // ─── Position canonical ID → display name ───────────────────────────────────────────
 // External consumers use ONavGetPositionDisplayNames(); this table is the internal authority.
 
-inline const std::unordered_map<std::string, std::string> kPositionDisplayNames = {
+inline constexpr auto kPositionDisplayNames = ::OStimNavigator::MakeFrozenMap<std::string_view>({
     {"missionary",     ""},
     {"butterfly",      "(missionary, receiver's hips raised)"},
     {"matingpress",    "(missionary, receiver's legs pinned back)"},
@@ -127,14 +129,14 @@ inline const std::unordered_map<std::string, std::string> kPositionDisplayNames
     {"spitroast",      ""},
     {"wheelbarrow",    "(receiver's legs held up by giver, hands on ground)"},
     {"idle",           "idle"},
-};
+});
 
 // ─── Position canonical ID → common (pretty) name ──────────────────────────────
 // Only needed for positions whose well-known colloquial name differs from the
 // canonical key. PositionSentence uses this as the displayed label; the value in
 // kPositionDisplayNames is then appended as a parenthetical description suffix.
 
-inline const std::unordered_map<std::string, std::string> kPositionCommonNames = {
+inline constexpr auto kPositionCommonNames = ::OStimNavigator::MakeFrozenMap<std::string_view>({
     {"prone",          "prone bone"},
     {"reversecowgirl", "reverse cowgirl"},
     {"matingpress",    "mating press"},
@@ -142,11 +144,11 @@ inline const std::unordered_map<std::string, std::string> kPositionCommonNames =
     {"reverselotus",   "reverse lotus"},
     {"sixtynine",      "sixty-nine"},
     {"spitroast",      "spit roast"},
-};
+});
 
 // ─── Internal-only tables ────────────────────────────────────────────────────
 
-inline const std::unordered_map<std::string, std::string> kActorTagLabels = {
+inline constexpr auto kActorTagLabels = ::OStimNavigator::MakeFrozenMap<std::string_view>({
     {"allfours",     "on all fours"},
     {"bendover",     "bent over"},
     {"drowsy",       "drowsy"},
@@ -171,7 +173,7 @@ inline const std::unordered_map<std::string, std::string> kActorTagLabels = {
     {"suspended",    "suspended"},
     {"upsidedown",   "upside-down"},
     {"climaxing",    "climaxing"},
-};
+});
 
 inline const std::vector<std::string> kActorTagSuggestions = {
     // upright
@@ -203,16 +205,16 @@ inline const std::vector<std::string> kActorTagSuggestions = {
 // Fill both fields when the verb alone is ambiguous (e.g. "fingers").
 
 struct ActionPhrase {
-    std::string verbPhrase;
-    std::string actorOrgan;
-    std::string targetOrgan;
+    std::string_view verbPhrase;
+    std::string_view actorOrgan;
+    std::string_view targetOrgan;
 };
 
 // ─── Action type → { verb phrase, actor organ, target organ } ────────────────
 // Used as: "{{actor}} [verbPhrase] {{target}}"
 // For self-actions the target reference is omitted.
 
-inline const std::unordered_map<std::string, ActionPhrase> kActionPhrases = {
+inline constexpr auto kActionPhrases = ::OStimNavigator::MakeFrozenMap<ActionPhrase>({
     // ── Intercourse ──────────────────────────────────────────────────────────
     {"vaginalsex",               {"has vaginal sex with",              "penis",   ""      }},
     {"analsex",                  {"has anal sex with",                 "penis",   ""      }},
@@ -300,36 +302,36 @@ inline const std::unordered_map<std::string, ActionPhrase> kActionPhrases = {
     {"ticklingfoot",             {"tickles the foot of",               "",        ""      }},
     {"spanking",                 {"spanks the butt of",                "",        ""      }},
     {"breastslapping",           {"slaps the breasts of",              "",        ""      }},
-};
+});
 
 // ─── Self-directed and two-sided action sets ──────────────────────────────────
 
-inline const std::unordered_set<std::string> kSelfActionTypes = {
+inline constexpr auto kSelfActionTypes = ::OStimNavigator::MakeFrozenSet({
     "malemasturbation",
     "femalemasturbation",
-};
+});
 
 // Two-sided actions: a single action record implies both actors participate mutually.
 // Source: "info": "X is two sided, you don't need to add two actions for it" in OStim action JSONs.
-inline const std::unordered_set<std::string> kTwoSidedActionTypes = {
+inline constexpr auto kTwoSidedActionTypes = ::OStimNavigator::MakeFrozenSet({
     "kissing",
     "frenchkissing",
     "holdinghand",
     "tribbing",
-};
+});
 
 // Mutual verb phrase used when rendering two-sided actions:
 // "{{A}} and {{T}} [mutualVerb]"
-inline const std::unordered_map<std::string, std::string> kMutualVerbPhrases = {
+inline constexpr auto kMutualVerbPhrases = ::OStimNavigator::MakeFrozenMap<std::string_view>({
     {"kissing",       "kiss"},
     {"frenchkissing", "french-kiss"},
     {"holdinghand",   "hold hands"},
     {"tribbing",      "trib"},
-};
+});
 
 // ─── Body part → readable label ──────────────────────────────────────────────
 
-inline const std::unordered_map<std::string, std::string> kBodyPartLabels = {
+inline constexpr auto kBodyPartLabels = ::OStimNavigator::MakeFrozenMap<std::string_view>({
     {"penis",     "penis"},
     {"vagina",    "vagina"},
     {"anus",      "anus"},
@@ -341,7 +343,7 @@ inline const std::unordered_map<std::string, std::string> kBodyPartLabels = {
     {"testicles", "testicles"},
     {"inwater",   "water"},
     {"vampire",   "fangs"},
-};
+});
 
 // Priority order used when picking the most descriptive body part from a requirements set.
 inline const std::vector<std::string> kBodyPartPriority = {
@@ -354,7 +356,7 @@ inline const std::vector<std::string> kBodyPartPriority = {
 
 struct FurniturePhrase { const char* prep; const char* display; };
 
-inline const std::unordered_map<std::string, FurniturePhrase> kFurniturePhrases = {
+inline constexpr auto kFurniturePhrases = ::OStimNavigator::MakeFrozenMap<FurniturePhrase>({
     {"alchemytable",        {"at",      "an alchemy table"}},
     {"bench",               {"on",      "a bench"}},
     {"chair",               {"on",      "a chair"}},
@@ -372,7 +374,7 @@ inline const std::unordered_map<std::string, FurniturePhrase> kFurniturePhrases
     {"singlebed",           {"on",      "a bed"}},
     {"doublebed",           {"on",      "a bed"}},
     {"bedroll",             {"on",      "a bedroll"}},
-};
+});
 
 // ─── OStimNet intent values ─────────────────────────────────────────────────
 // Internal-only: used by PrismaUIManager to populate UI suggestion lists.
@@ -383,7 +385,7 @@ inline const std::vector<std::string> kOStimNetIntents = {
 // ─── Sexual action types ─────────────────────────────────────────────────────
 // Subset of kActionPhrases keys that represent explicitly sexual acts.
 // Used by SceneDatabase and ONavGetAllActions to filter sex-relevant actions.
-inline const std::unordered_set<std::string> kSexualActionTypes = {
+inline constexpr auto kSexualActionTypes = ::OStimNavigator::MakeFrozenSet({
     // intercourse
     "vaginalsex", "analsex", "tribbing",
     // oral
@@ -403,7 +405,7 @@ inline const std::unordered_set<std::string> kSexualActionTypes = {
     "facial", "cumonbutt", "cumonchest", "cumonvulva",
     // masturbation
     "malemasturbation", "femalemasturbation",
-};
+});
 
 } // namespace OStimNavigatorAPI
 
@@ -3,270 +3,623 @@
 #include "ActionDatabase.h"
 #include "ActorPropertiesDatabase.h"
 #include "FurnitureDatabase.h"
+#include "SceneQueryPlan.h"
 #include "SceneSimilarity.h"
+#include "Settings.h"
 #include "StringUtils.h"
+#include "WorkerPool.h"
 #include <algorithm>
+#include <chrono>
 
 namespace OStimNavigator {
 
     namespace {
-        // Helper: get RE::Actor* for a given actor slot in a thread using the new API
-        RE::Actor* GetActorFromThread(uint32_t threadID, int index) {
-            if (index < 0)
-                return nullptr;
-            return OStimIntegration::GetSingleton().GetActorFromThread(threadID, static_cast<uint32_t>(index));
+        using Criterion = IncrementalSceneFilter::Criterion;
+        using Inputs = IncrementalSceneFilter::Inputs;
+        using Selection = IncrementalSceneFilter::Selection;
+
+        // Relative cost of testing one candidate, for plan ordering
+        constexpr double kColumnCost = 1.0;             // One column compare
+        constexpr double kBitsetCost = 2.0;             // One masked row test
+        constexpr double kActorBitsetCost = 6.0;        // A masked row test per scene actor
+        constexpr double kSubstringCost = 8.0;          // Substring search in name and ID
+        constexpr double kIntendedSexCost = 4.0;        // A sex compare per slot
+        constexpr double kRequirementsCost = 3.0;       // A mask test per slot with requirements
+
+        constexpr const char* kCriterionNames[IncrementalSceneFilter::kCriterionCount] = {
+            "actor count", "hidden flags", "furniture", "search", "modpacks", "scene tags",
+            "actions", "action tags", "actor tags", "intended sex", "requirements"
+        };
+
+        constexpr size_t kNoPredicate = SIZE_MAX;
+
+        // Similarity scores worth one parallel chunk
+        constexpr size_t kMinScoresPerChunk = 256;
+
+        // Threads a filter run uses: requested, or what the settings ask for
+        size_t FilterThreads(size_t requested) {
+            const auto& settings = Settings::GetSingleton();
+            if (requested > 0) return requested;
+            if (!settings.parallelSceneFilter) return 1;
+            return settings.sceneFilterThreads > 0 ? settings.sceneFilterThreads : WorkerPool::GetSingleton().MaxThreads();
         }
 
-        // Helper: Check if actor meets requirements
-        bool ValidateRoleRequirements(
-            const std::unordered_set<std::string>& requirements,
-            RE::Actor* actor,
-            ActorPropertiesDatabase& propsDB
-        ) {
-            if (requirements.empty() || !actor)
-                return true;
-
-            auto actorReqs = propsDB.GetActorRequirements(actor);
-            for (const auto& req : requirements) {
-                if (actorReqs.find(req) == actorReqs.end())
-                    return false;
+        // A filter run: its inputs and the plan over them. The predicates refer
+        // to the members, so a query stays where it was built.
+        struct FilterQuery {
+            FilterQuery(const ThreadContext& thread, uint32_t sceneCount) : thread(thread), plan(sceneCount) {
+                predicates.fill(kNoPredicate);
             }
-            return true;
+            FilterQuery(const FilterQuery&) = delete;
+            FilterQuery& operator=(const FilterQuery&) = delete;
+
+            const ThreadContext& thread;
+            Inputs inputs;
+            std::unordered_set<Symbol> compatibleFurniture;
+            std::unordered_set<Symbol> modpacks;
+            std::unordered_map<uint32_t, float> searchScores;  // Fuzzy search relevance
+            std::array<size_t, IncrementalSceneFilter::kCriterionCount> predicates;     // Plan predicate per criterion
+            SceneQueryPlan plan;
+        };
+
+        bool SymbolLess(Symbol a, Symbol b) {
+            return a.Id() < b.Id();
         }
 
-        // Helper: Generic tag filtering with AND/OR logic
-        template<typename Container>
-        bool MatchesTagFilter(
-            const Container& itemTags,
-            const std::unordered_set<std::string>& selectedTags,
-            bool useAND
-        ) {
-            if (useAND) {
-                for (const auto& selectedTag : selectedTags) {
-                    bool found = false;
-                    for (const auto& tag : itemTags) {
-                        if (tag == selectedTag) { found = true; break; }
-                    }
-                    if (!found) return false;
+        Selection MakeSelection(const std::unordered_set<std::string>& values, bool matchAll) {
+            Selection selection{ InternAll(values), matchAll };
+            std::sort(selection.keys.begin(), selection.keys.end(), SymbolLess);
+            return selection;
+        }
+
+        PostingList Union(const PostingList& a, const PostingList& b) {
+            PostingList result;
+            result.reserve(a.size() + b.size());
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(result));
+            return result;
+        }
+
+        // Resolve every string the filters compare against to a symbol up front,
+        // and everything they need from the thread
+        Inputs ResolveInputs(const ThreadContext& thread, const SceneFilterSettings& settings) {
+            auto& actionDB = ActionDatabase::GetSingleton();
+            auto& furnitureDB = FurnitureDatabase::GetSingleton();
+            const SceneIndexes& indexes = SceneDatabase::GetSingleton().GetIndexes();
+
+            Inputs inputs;
+            inputs.threadID = thread.threadID;
+            inputs.actorCount = thread.ActorCount();
+            for (const ThreadActor& actor : thread.actors) {
+                inputs.actors.push_back(actor.actor);
+            }
+
+            // Furniture filtering using actor factions, decided once per furniture type
+            inputs.furnitureLoaded = furnitureDB.IsLoaded();
+            if (inputs.furnitureLoaded) {
+                std::unordered_set<Symbol> threadFurnitureTypes;
+                for (const auto& type : thread.furnitureTypes) {
+                    threadFurnitureTypes.insert(Symbol::Intern(type));
                 }
-                return true;
-            } else {
-                for (const auto& tag : itemTags) {
-                    if (selectedTags.find(tag) != selectedTags.end())
-                        return true;
+                for (const auto& [type, scenes] : indexes.furnitureTypes) {
+                    if (furnitureDB.IsSceneCompatible(threadFurnitureTypes, type))
+                        inputs.compatibleFurniture.push_back(type);
                 }
-                return false;
+                std::sort(inputs.compatibleFurniture.begin(), inputs.compatibleFurniture.end(), SymbolLess);
             }
-        }
-    }
-
-    SceneFilterResult SceneFilter::ApplyFilters(
-        uint32_t threadID,
-        SceneData* currentScene,
-        const SceneFilterSettings& settings
-    ) {
-        SceneFilterResult result;
 
-        auto& ostim      = OStimIntegration::GetSingleton();
-        auto& sceneDB    = SceneDatabase::GetSingleton();
-        auto& actionDB   = ActionDatabase::GetSingleton();
-        auto& furnitureDB = FurnitureDatabase::GetSingleton();
+            // Flags that exclude a scene outright
+            if (settings.hideTransitions) inputs.hiddenFlags |= SceneColumns::kTransition;
+            if (settings.hideNonRandom) inputs.hiddenFlags |= SceneColumns::kNoRandomSelection;
+            if (settings.hideIntroIdle) inputs.hiddenFlags |= SceneColumns::kIntroOrIdle;
 
-        if (!sceneDB.IsLoaded())
-            return result;
+            if (settings.searchText && settings.searchText[0] != '\0') {
+                inputs.search = StringUtils::ToLowerCopy(settings.searchText);
+                inputs.fuzzySearch = settings.fuzzySearch;
+            }
 
-        auto* iface = ostim.GetThreadInterface();
-        uint32_t threadActorCount = iface ? iface->GetActorCount(threadID) : 0;
+            inputs.modpacks = MakeSelection(settings.selectedModpacks, false);
+            inputs.sceneTags = MakeSelection(settings.selectedSceneTags, settings.sceneTagsAND);
+            inputs.actorTags = MakeSelection(settings.selectedActorTags, settings.actorTagsAND);
+            inputs.actions = MakeSelection(settings.selectedActions, settings.actionsAND);
+            inputs.actionTags = MakeSelection(settings.selectedActionTags, settings.actionTagsAND);
 
-        auto allScenes = sceneDB.GetAllScenes();
+            inputs.intendedSex = settings.useIntendedSex;
+            inputs.requirements = settings.validateRequirements && actionDB.IsLoaded() &&
+                                  ActorPropertiesDatabase::GetSingleton().IsLoaded();
+            return inputs;
+        }
 
-        // Get thread's furniture types by checking actor factions
-        std::unordered_set<std::string> threadFurnitureTypes;
-        if (furnitureDB.IsLoaded()) {
-            if (RE::Actor* actor = GetActorFromThread(threadID, 0)) {
-                threadFurnitureTypes = furnitureDB.GetFurnitureTypesFromActor(actor);
+        // Scenes matching all (matchAll) or any of keys: exact for a single
+        // key, otherwise an upper bound from the posting list sizes
+        double EstimateMatch(const SceneIndexes::SymbolIndex& index, std::span<const Symbol> keys, bool matchAll, uint32_t sceneCount) {
+            double estimate = matchAll ? sceneCount : 0.0;
+            for (Symbol key : keys) {
+                const double size = static_cast<double>(SceneIndexes::Find(index, key).size());
+                estimate = matchAll ? std::min(estimate, size) : estimate + size;
             }
+            return std::min(estimate, static_cast<double>(sceneCount));
         }
 
-        for (auto* scene : allScenes) {
-            if (!scene) continue;
+        // A multi-select over an indexed vocabulary that also has a bitset table
+        size_t AddSelection(SceneQueryPlan& plan, const char* name, const SceneIndexes::SymbolIndex& index,
+                            const BitsetTable& table, const Selection& selection) {
+            const bool matchAll = selection.matchAll;
+            return plan.Add(name, EstimateMatch(index, selection.keys, matchAll, table.Size()), kBitsetCost,
+                [&index, &selection, matchAll] { return SceneIndexes::Match(index, selection.keys, matchAll); },
+                [&table, mask = table.Compile(selection.keys), matchAll](PostingList& rows) { table.Filter(mask, matchAll, rows); });
+        }
+
+        // A single-valued column that must hold one of allowed
+        size_t AddMembership(SceneQueryPlan& plan, const char* name, const SceneIndexes::SymbolIndex& index,
+                             const std::vector<Symbol>& column, const std::vector<Symbol>& keys,
+                             const std::unordered_set<Symbol>& allowed) {
+            double estimate = 0.0;
+            for (Symbol value : keys) {
+                estimate += static_cast<double>(SceneIndexes::Find(index, value).size());
+            }
+            return plan.Add(name, estimate, kColumnCost,
+                [&index, &keys] { return SceneIndexes::Match(index, keys, false); },
+                [&column, &allowed](PostingList& rows) {
+                    std::erase_if(rows, [&](uint32_t row) { return !allowed.contains(column[row]); });
+                });
+        }
 
-            // Filter by actor count (must match thread)
-            if (scene->actorCount != threadActorCount)
-                continue;
+        // ── Query plan ───────────────────────────────────────────────────────
+        // Every criterion becomes a predicate with an estimate from the index
+        // statistics; the plan decides the order and how each one is applied.
+        void BuildPlan(FilterQuery& query) {
+            auto& sceneDB = SceneDatabase::GetSingleton();
+            const SceneColumns& columns = sceneDB.GetColumns();
+            const SceneIndexes& indexes = sceneDB.GetIndexes();
+            const SceneBitsets& bitsets = sceneDB.GetBitsets();
+            const Inputs& inputs = query.inputs;
+            const uint32_t sceneCount = columns.Size();
+            const ThreadContext& thread = query.thread;
+            const uint32_t threadActorCount = inputs.actorCount;
+            SceneQueryPlan& plan = query.plan;
+            auto& predicates = query.predicates;
+
+            // Actor count (must match thread)
+            predicates[Criterion::kActorCount] = plan.Add(kCriterionNames[Criterion::kActorCount],
+                static_cast<double>(SceneIndexes::Find(indexes.actorCounts, threadActorCount).size()), kColumnCost,
+                [&indexes, threadActorCount] { return SceneIndexes::Find(indexes.actorCounts, threadActorCount); },
+                [&columns, threadActorCount](PostingList& rows) {
+                    std::erase_if(rows, [&](uint32_t index) { return columns.actorCount[index] != threadActorCount; });
+                });
+
+            // Hide transitions, non-random selection and intro/idle scenes
+            if (const uint8_t hiddenFlags = inputs.hiddenFlags) {
+                uint32_t visible = 0;
+                for (const auto& [flags, count] : indexes.flagCounts) {
+                    if (!(flags & hiddenFlags)) visible += count;
+                }
+                predicates[Criterion::kHiddenFlags] = plan.Add(kCriterionNames[Criterion::kHiddenFlags], visible, kColumnCost, nullptr,
+                    [&columns, hiddenFlags](PostingList& rows) {
+                        std::erase_if(rows, [&](uint32_t index) { return (columns.flags[index] & hiddenFlags) != 0; });
+                    });
+            }
 
-            // Furniture filtering using actor factions
-            if (furnitureDB.IsLoaded()) {
-                if (!furnitureDB.IsSceneCompatible(threadFurnitureTypes, scene->furnitureType))
-                    continue;
+            if (inputs.furnitureLoaded) {
+                query.compatibleFurniture.insert(inputs.compatibleFurniture.begin(), inputs.compatibleFurniture.end());
+                predicates[Criterion::kFurniture] = AddMembership(plan, kCriterionNames[Criterion::kFurniture],
+                    indexes.furnitureTypes, columns.furnitureType, inputs.compatibleFurniture, query.compatibleFurniture);
             }
 
-            // Hide transitions filter
-            if (settings.hideTransitions && scene->isTransition)
-                continue;
-
-            // Hide non-random selection scenes
-            if (settings.hideNonRandom && scene->noRandomSelection)
-                continue;
-
-            // Hide intro/idle scenes
-            if (settings.hideIntroIdle) {
-                bool hasIntroOrIdle = false;
-                for (const auto& tag : scene->tags) {
-                    std::string lowerTag = StringUtils::ToLowerCopy(tag);
-                    if (lowerTag == "intro" || lowerTag == "idle") {
-                        hasIntroOrIdle = true;
-                        break;
+            // Search filter (name or ID, or fuzzy over name, ID, modpack and tags)
+            const SceneSearchIndex& searchIndex = sceneDB.GetSearchIndex();
+            if (!inputs.search.empty()) {
+                if (inputs.fuzzySearch) {
+                    // Ranking needs every hit's score, so the search itself runs now
+                    PostingList hits;
+                    for (const auto& hit : searchIndex.FuzzySearch(inputs.search)) {
+                        hits.push_back(hit.index);
+                        query.searchScores[hit.index] = hit.score;
                     }
+                    std::sort(hits.begin(), hits.end());
+                    predicates[Criterion::kSearch] = plan.Add("fuzzy search", static_cast<double>(hits.size()), kColumnCost,
+                        [hits = std::move(hits)] { return hits; },
+                        [&scores = query.searchScores](PostingList& rows) {
+                            std::erase_if(rows, [&](uint32_t index) { return !scores.contains(index); });
+                        });
+                } else {
+                    const std::string& search = inputs.search;
+                    predicates[Criterion::kSearch] = plan.Add(kCriterionNames[Criterion::kSearch],
+                        static_cast<double>(searchIndex.EstimateMatches(search)), kSubstringCost,
+                        [&searchIndex, &search] { return searchIndex.Search(search); },
+                        [&searchIndex, &search](PostingList& rows) {
+                            std::erase_if(rows, [&](uint32_t index) {
+                                return searchIndex.LowerName(index).find(search) == std::string::npos &&
+                                       searchIndex.LowerId(index).find(search) == std::string::npos;
+                            });
+                        });
                 }
-                if (hasIntroOrIdle) continue;
             }
 
-            // Intended sex filter
-            if (settings.useIntendedSex) {
-                bool sexMismatch = false;
-                for (uint32_t i = 0; i < scene->actorCount; ++i) {
-                    if (i < scene->actors.size()) {
-                        const auto& sceneActor = scene->actors[i];
-                        std::string intendedSex = StringUtils::ToLowerCopy(sceneActor.intendedSex);
-
-                        if (intendedSex == "male" || intendedSex == "female") {
-                            if (RE::Actor* actor = GetActorFromThread(threadID, i)) {
-                                auto sexValue = actor->GetActorBase()->GetSex();
-                                bool isMale = (sexValue == RE::SEXES::kMale);
-
-                                if ((intendedSex == "male" && !isMale) ||
-                                    (intendedSex == "female" && isMale)) {
-                                    sexMismatch = true;
-                                    break;
+            // Modpack filter
+            if (!inputs.modpacks.keys.empty()) {
+                query.modpacks.insert(inputs.modpacks.keys.begin(), inputs.modpacks.keys.end());
+                predicates[Criterion::kModpacks] = AddMembership(plan, kCriterionNames[Criterion::kModpacks],
+                    indexes.modpacks, columns.modpack, inputs.modpacks.keys, query.modpacks);
+            }
+
+            // Scene tags, actions and action tags: index lookup or bitset mask
+            if (!inputs.sceneTags.keys.empty())
+                predicates[Criterion::kSceneTags] = AddSelection(plan, kCriterionNames[Criterion::kSceneTags],
+                    indexes.sceneTags, bitsets.sceneTags, inputs.sceneTags);
+            if (!inputs.actions.keys.empty())
+                predicates[Criterion::kActions] = AddSelection(plan, kCriterionNames[Criterion::kActions],
+                    indexes.actions, bitsets.actions, inputs.actions);
+            if (!inputs.actionTags.keys.empty())
+                predicates[Criterion::kActionTags] = AddSelection(plan, kCriterionNames[Criterion::kActionTags],
+                    indexes.actionTags, bitsets.actionTags, inputs.actionTags);
+
+            // Actor tags filter (AND mode: a single actor must have every tag)
+            if (!inputs.actorTags.keys.empty()) {
+                if (inputs.actorTags.matchAll) {
+                    predicates[Criterion::kActorTags] = plan.Add(kCriterionNames[Criterion::kActorTags],
+                        EstimateMatch(indexes.actorTags, inputs.actorTags.keys, true, sceneCount), kActorBitsetCost, nullptr,
+                        [&columns, &bitsets, mask = bitsets.actorTagsByActor.Compile(inputs.actorTags.keys)](PostingList& rows) {
+                            std::erase_if(rows, [&](uint32_t index) {
+                                for (uint32_t actor = columns.actorOffsets[index]; actor < columns.actorOffsets[index + 1]; ++actor) {
+                                    if (bitsets.actorTagsByActor.Matches(actor, mask, true))
+                                        return false;
                                 }
-                            }
-                        }
+                                return true;
+                            });
+                        });
+                } else {
+                    predicates[Criterion::kActorTags] = AddSelection(plan, kCriterionNames[Criterion::kActorTags],
+                        indexes.actorTags, bitsets.actorTags, inputs.actorTags);
+                }
+            }
+
+            // Intended sex filter
+            if (inputs.intendedSex) {
+                // A slot rejects the scenes that want the other sex there
+                double passing = sceneCount;
+                for (uint32_t i = 0; i < threadActorCount && i < indexes.intendedMale.size(); ++i) {
+                    if (const ThreadActor* actor = thread.Actor(i)) {
+                        const uint32_t opposite = actor->isMale ? indexes.intendedFemale[i] : indexes.intendedMale[i];
+                        passing *= sceneCount > 0 ? 1.0 - static_cast<double>(opposite) / sceneCount : 1.0;
                     }
                 }
-                if (sexMismatch) continue;
+
+                const Symbol male = Symbol::Intern("male");
+                const Symbol female = Symbol::Intern("female");
+                predicates[Criterion::kIntendedSex] = plan.Add(kCriterionNames[Criterion::kIntendedSex], passing, kIntendedSexCost, nullptr,
+                    [&columns, &thread, threadActorCount, male, female](PostingList& rows) {
+                        std::erase_if(rows, [&](uint32_t index) {
+                            const uint32_t firstActor = columns.actorOffsets[index];
+                            const uint32_t sceneActorCount = columns.actorOffsets[index + 1] - firstActor;
+
+                            for (uint32_t i = 0; i < threadActorCount; ++i) {
+                                if (i < sceneActorCount) {
+                                    Symbol intendedSex = columns.actorSex[firstActor + i];
+
+                                    if (intendedSex == male || intendedSex == female) {
+                                        if (const ThreadActor* actor = thread.Actor(i)) {
+                                            if ((intendedSex == male && !actor->isMale) ||
+                                                (intendedSex == female && actor->isMale)) {
+                                                return true;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                            return false;
+                        });
+                    });
             }
 
             // Actor requirements validation filter
-            if (settings.validateRequirements && actionDB.IsLoaded()) {
-                auto& propsDB = ActorPropertiesDatabase::GetSingleton();
-                if (propsDB.IsLoaded()) {
-                    bool requirementsMismatch = false;
-
-                    for (const auto& sceneAction : scene->actions) {
-                        const ActionData* actionData = actionDB.GetAction(sceneAction.type);
-                        if (!actionData) continue;
-
-                        if (RE::Actor* actor = GetActorFromThread(threadID, sceneAction.actor)) {
-                            if (!ValidateRoleRequirements(actionData->actorRequirements, actor, propsDB)) {
-                                requirementsMismatch = true; break;
-                            }
-                        }
-                        if (RE::Actor* actor = GetActorFromThread(threadID, sceneAction.target)) {
-                            if (!ValidateRoleRequirements(actionData->targetRequirements, actor, propsDB)) {
-                                requirementsMismatch = true; break;
-                            }
-                        }
-                        if (RE::Actor* actor = GetActorFromThread(threadID, sceneAction.performer)) {
-                            if (!ValidateRoleRequirements(actionData->performerRequirements, actor, propsDB)) {
-                                requirementsMismatch = true; break;
-                            }
-                        }
-                        if (requirementsMismatch) break;
+            if (inputs.requirements) {
+                // What each thread slot offers, laid out like the scenes' per-slot
+                // masks. Empty slots meet everything and are skipped.
+                const uint32_t stride = columns.requirementStride;
+                std::vector<uint64_t> offered(static_cast<size_t>(threadActorCount) * stride, 0);
+                std::vector<uint8_t> meetsAll(threadActorCount, 0);
+                for (uint32_t i = 0; i < threadActorCount; ++i) {
+                    if (thread.MeetsAllRequirements(i)) {
+                        meetsAll[i] = 1;
+                        continue;
                     }
-                    if (requirementsMismatch) continue;
+                    const RequirementMask& mask = thread.Actor(i)->requirements;
+                    std::copy_n(mask.begin(), std::min<size_t>(mask.size(), stride), offered.begin() + static_cast<size_t>(i) * stride);
                 }
+
+                // Scenes without requirements always pass; assume half of the rest do
+                predicates[Criterion::kRequirements] = plan.Add(kCriterionNames[Criterion::kRequirements],
+                    sceneCount - indexes.requirementScenes / 2.0, kRequirementsCost, nullptr,
+                    [&columns, stride, offered = std::move(offered), meetsAll = std::move(meetsAll)](PostingList& rows) {
+                        std::erase_if(rows, [&](uint32_t index) {
+                            const auto required = columns.RequirementMasks(index);
+                            for (size_t slot = 0; slot * stride < required.size(); ++slot) {
+                                if (slot >= meetsAll.size() || meetsAll[slot])
+                                    continue;
+                                const uint64_t* need = required.data() + slot * stride;
+                                const uint64_t* have = offered.data() + slot * stride;
+                                for (uint32_t w = 0; w < stride; ++w) {
+                                    if ((need[w] & ~have[w]) != 0)
+                                        return true;
+                                }
+                            }
+                            return false;
+                        });
+                    });
             }
+        }
 
-            // Search filter (name or ID)
-            if (settings.searchText && settings.searchText[0] != '\0') {
-                std::string search    = StringUtils::ToLowerCopy(settings.searchText);
-                std::string sceneName = StringUtils::ToLowerCopy(scene->name);
-                std::string sceneID   = StringUtils::ToLowerCopy(scene->id);
+        // ── Change detection ─────────────────────────────────────────────────
+        // How a criterion's new setting relates to its previous one
+        enum class Change { kSame, kNarrower, kWider, kOther };
 
-                if (sceneName.find(search) == std::string::npos &&
-                    sceneID.find(search) == std::string::npos)
-                    continue;
+        const char* ChangeName(Change change) {
+            switch (change) {
+                case Change::kNarrower: return "narrowed";
+                case Change::kWider:    return "widened";
+                default:                return "changed";
             }
+        }
 
-            // Modpack filter
-            if (!settings.selectedModpacks.empty() &&
-                settings.selectedModpacks.find(scene->modpack) == settings.selectedModpacks.end())
-                continue;
-
-            // Scene tags filter
-            if (!settings.selectedSceneTags.empty()) {
-                if (!MatchesTagFilter(scene->tags, settings.selectedSceneTags, settings.sceneTagsAND))
-                    continue;
+        Change CompareToggle(bool before, bool after) {
+            return before == after ? Change::kSame : after ? Change::kNarrower : Change::kWider;
+        }
+
+        // More hidden flags hide more scenes
+        Change CompareFlags(uint8_t before, uint8_t after) {
+            if (before == after) return Change::kSame;
+            if ((after & before) == before) return Change::kNarrower;
+            if ((after & before) == after) return Change::kWider;
+            return Change::kOther;
+        }
+
+        // True if every key of b is in a (both sorted)
+        bool Includes(const std::vector<Symbol>& a, const std::vector<Symbol>& b) {
+            return std::includes(a.begin(), a.end(), b.begin(), b.end(), SymbolLess);
+        }
+
+        // An empty selection is off; more keys narrow "has all" and widen "has any"
+        Change CompareSelection(const Selection& before, const Selection& after) {
+            if (before.keys.empty() && after.keys.empty()) return Change::kSame;   // Mode of an unused selection
+            if (before == after) return Change::kSame;
+            if (before.keys.empty()) return Change::kNarrower;
+            if (after.keys.empty()) return Change::kWider;
+            if (before.keys == after.keys) return after.matchAll ? Change::kNarrower : Change::kWider;
+            if (before.matchAll == after.matchAll) {
+                if (Includes(after.keys, before.keys)) return after.matchAll ? Change::kNarrower : Change::kWider;
+                if (Includes(before.keys, after.keys)) return after.matchAll ? Change::kWider : Change::kNarrower;
             }
+            return Change::kOther;
+        }
 
-            // Actor tags filter
-            if (!settings.selectedActorTags.empty()) {
-                bool matchFound = false;
-                for (const auto& actor : scene->actors) {
-                    if (MatchesTagFilter(actor.tags, settings.selectedActorTags, settings.actorTagsAND)) {
-                        matchFound = true; break;
-                    }
-                }
-                if (!matchFound) continue;
+        // A longer substring matches fewer scenes; fuzzy results are not nested
+        Change CompareSearch(const Inputs& before, const Inputs& after) {
+            if (before.search.empty() && after.search.empty()) return Change::kSame;
+            if (before.search == after.search && before.fuzzySearch == after.fuzzySearch) return Change::kSame;
+            if (before.search.empty()) return Change::kNarrower;
+            if (after.search.empty()) return Change::kWider;
+            if (before.fuzzySearch || after.fuzzySearch) return Change::kOther;
+            if (after.search.find(before.search) != std::string::npos) return Change::kNarrower;
+            if (before.search.find(after.search) != std::string::npos) return Change::kWider;
+            return Change::kOther;
+        }
+
+        bool SameThread(const Inputs& before, const Inputs& after) {
+            return before.threadID == after.threadID && before.actorCount == after.actorCount &&
+                   before.actors == after.actors && before.furnitureLoaded == after.furnitureLoaded &&
+                   before.compatibleFurniture == after.compatibleFurniture;
+        }
+    }
+
+    SceneFilterResult SceneFilter::ApplyFilters(
+        const ThreadContext& thread,
+        SceneHandle currentScene,
+        const SceneFilterSettings& settings
+    ) {
+        IncrementalSceneFilter filter;
+        return filter.Apply(thread, currentScene, settings);
+    }
+
+    void SceneFilter::Benchmark(
+        const ThreadContext& thread,
+        SceneHandle currentScene,
+        const SceneFilterSettings& settings
+    ) {
+        constexpr int kRuns = 5;
+        const size_t maxThreads = WorkerPool::GetSingleton().MaxThreads();
+
+        std::vector<size_t> threadCounts;
+        for (size_t threads = 1; threads < maxThreads; threads *= 2) {
+            threadCounts.push_back(threads);
+        }
+        threadCounts.push_back(maxThreads);
+
+        SKSE::log::info("Scene filter benchmark: {} scenes, best of {} runs",
+            SceneDatabase::GetSingleton().GetColumns().Size(), kRuns);
+
+        std::vector<SceneHandle> reference;
+        double serialMicros = 0.0;
+        for (size_t threads : threadCounts) {
+            IncrementalSceneFilter filter;
+            filter.SetThreads(threads);
+
+            double best = 0.0;
+            SceneFilterResult result;
+            for (int run = 0; run < kRuns; ++run) {
+                filter.Reset();
+                const auto start = std::chrono::steady_clock::now();
+                result = filter.Apply(thread, currentScene, settings);
+                const double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+                best = run == 0 ? micros : std::min(best, micros);
             }
 
-            // Action filter
-            if (!settings.selectedActions.empty()) {
-                std::vector<std::string> actionTypes;
-                for (const auto& action : scene->actions)
-                    actionTypes.push_back(action.type);
-                if (!MatchesTagFilter(actionTypes, settings.selectedActions, settings.actionsAND))
-                    continue;
+            if (threads == 1) {
+                reference = result.filteredScenes;
+                serialMicros = best;
             }
+            const bool same = result.filteredScenes == reference;
+            SKSE::log::info("  {:>2} thread(s): {:>8.0f} us, {:.2f}x, {} scenes{}", threads, best,
+                best > 0.0 ? serialMicros / best : 0.0, result.filteredScenes.size(), same ? "" : " (DIFFERS from 1 thread)");
+        }
+    }
 
-            // Action tags filter
-            if (!settings.selectedActionTags.empty()) {
-                auto sceneActionTags = actionDB.GetTagsFromActions(scene->actions);
+    void IncrementalSceneFilter::Reset() {
+        m_valid = false;
+        m_inputs = {};
+        m_matched.clear();
+        m_rejected = {};
+        m_similarityScene = {};
+        m_similarity.clear();
+    }
 
-                if (settings.actionTagsAND) {
-                    bool hasAllTags = true;
-                    for (const auto& selectedTag : settings.selectedActionTags) {
-                        if (sceneActionTags.find(selectedTag) == sceneActionTags.end()) {
-                            hasAllTags = false; break;
-                        }
-                    }
-                    if (!hasAllTags) continue;
-                } else {
-                    bool hasTag = false;
-                    for (const auto& selectedTag : settings.selectedActionTags) {
-                        if (sceneActionTags.find(selectedTag) != sceneActionTags.end()) {
-                            hasTag = true; break;
-                        }
-                    }
-                    if (!hasTag) continue;
+    SceneFilterResult IncrementalSceneFilter::Apply(const ThreadContext& thread, SceneHandle currentScene, const SceneFilterSettings& settings) {
+        SceneFilterResult result;
+
+        auto& sceneDB = SceneDatabase::GetSingleton();
+        if (!sceneDB.IsReady()) {
+            Reset();
+            return result;
+        }
+
+        const SceneColumns& columns = sceneDB.GetColumns();
+        const bool explain = Settings::GetSingleton().explainFilterPlans;
+        const bool catalogChanged = m_catalogVersion != sceneDB.GetCatalogVersion();
+
+        const size_t threads = FilterThreads(m_threads);
+        FilterQuery query(thread, columns.Size());
+        query.inputs = ResolveInputs(thread, settings);
+        BuildPlan(query);
+        query.plan.SetThreads(threads);
+        const Inputs& inputs = query.inputs;
+
+        // Criteria whose setting changed since the last run
+        std::vector<std::pair<Criterion, Change>> changes;
+        bool rerun = !m_valid || catalogChanged || !SameThread(m_inputs, inputs);
+        if (!rerun) {
+            auto note = [&changes](Criterion criterion, Change change) {
+                if (change != Change::kSame) changes.emplace_back(criterion, change);
+            };
+            note(kHiddenFlags, CompareFlags(m_inputs.hiddenFlags, inputs.hiddenFlags));
+            note(kSearch, CompareSearch(m_inputs, inputs));
+            note(kModpacks, CompareSelection(m_inputs.modpacks, inputs.modpacks));
+            note(kSceneTags, CompareSelection(m_inputs.sceneTags, inputs.sceneTags));
+            note(kActions, CompareSelection(m_inputs.actions, inputs.actions));
+            note(kActionTags, CompareSelection(m_inputs.actionTags, inputs.actionTags));
+            note(kActorTags, CompareSelection(m_inputs.actorTags, inputs.actorTags));
+            note(kIntendedSex, CompareToggle(m_inputs.intendedSex, inputs.intendedSex));
+            note(kRequirements, CompareToggle(m_inputs.requirements, inputs.requirements));
+            rerun = changes.size() > 1;
+        }
+
+        // Scenes the plan rejected, filed under their criterion
+        auto fileRejected = [&](std::vector<PostingList>& rejected) {
+            for (size_t criterion = 0; criterion < kCriterionCount; ++criterion) {
+                const size_t predicate = query.predicates[criterion];
+                if (predicate != kNoPredicate && !rejected[predicate].empty()) {
+                    m_rejected[criterion] = Union(m_rejected[criterion], rejected[predicate]);
                 }
             }
+        };
+
+        if (rerun) {
+            std::vector<PostingList> rejected;
+            m_rejected = {};
+            m_matched = query.plan.Execute(explain, &rejected);
+            fileRejected(rejected);
+        } else if (!changes.empty()) {
+            const auto [criterion, change] = changes.front();
+            const size_t predicate = query.predicates[criterion];
+            PostingList previouslyRejected = std::move(m_rejected[criterion]);
+            m_rejected[criterion].clear();
+            size_t retested = 0;
+
+            // Narrower (or unrelated): the scenes that matched must pass the new setting
+            if (change != Change::kWider && predicate != kNoPredicate) {
+                retested += m_matched.size();
+                m_rejected[criterion] = query.plan.Apply(predicate, m_matched);
+            }
+
+            // Wider (or unrelated): the scenes it rejected get another chance,
+            // against every criterion since the others never saw them
+            if (change == Change::kNarrower) {
+                m_rejected[criterion] = Union(m_rejected[criterion], previouslyRejected);
+            } else {
+                retested += previouslyRejected.size();
+                std::vector<PostingList> rejected;
+                const PostingList passed = query.plan.Refine(std::move(previouslyRejected), explain, &rejected);
+                fileRejected(rejected);
+                m_matched = Union(m_matched, passed);
+            }
 
-            result.filteredScenes.push_back(scene);
+            if (explain) {
+                SKSE::log::info("Filter refinement: {} {}, {} of {} scenes re-tested, {} match",
+                    kCriterionNames[criterion], ChangeName(change), retested, columns.Size(), m_matched.size());
+            }
+        }
+
+        m_valid = true;
+        m_catalogVersion = sceneDB.GetCatalogVersion();
+
+        // Similarity scores against the current scene, kept until it changes
+        if (catalogChanged || m_similarityScene != currentScene) {
+            m_similarity.clear();
+            m_similarityScene = currentScene;
         }
+        const auto currentIndex = sceneDB.IndexOf(currentScene);
+        if (currentIndex) {
+            std::vector<uint32_t> unscored;
+            for (uint32_t index : m_matched) {
+                if (!m_similarity.contains(index)) unscored.push_back(index);
+            }
 
-        // Calculate and cache similarity scores if we have a current scene
-        if (currentScene) {
-            for (auto* scene : result.filteredScenes) {
-                float similarity = SceneSimilarity::CalculateSimilarityScore(currentScene, scene);
-                result.similarityScores[scene] = similarity;
+            // Each score only reads the columns; chunks write their own slots
+            std::vector<float> scores(unscored.size());
+            const size_t chunkCount = std::min(threads * 4, unscored.size() / kMinScoresPerChunk);
+            const size_t chunkSize = chunkCount > 1 ? (unscored.size() + chunkCount - 1) / chunkCount : unscored.size();
+            WorkerPool::GetSingleton().ParallelFor(std::max<size_t>(chunkCount, 1), threads, [&](size_t chunk) {
+                const size_t begin = std::min(chunk * chunkSize, unscored.size());
+                const size_t end = std::min(begin + chunkSize, unscored.size());
+                for (size_t i = begin; i < end; ++i) {
+                    scores[i] = SceneSimilarity::CalculateSimilarityScore(columns, *currentIndex, unscored[i]);
+                }
+            });
+            for (size_t i = 0; i < unscored.size(); ++i) {
+                m_similarity[unscored[i]] = scores[i];
             }
         }
 
-        // Sort by similarity score (descending), fallback to scene ID
-        std::sort(result.filteredScenes.begin(), result.filteredScenes.end(),
-            [&result](const SceneData* a, const SceneData* b) {
-                if (!result.similarityScores.empty()) {
-                    auto itA = result.similarityScores.find(const_cast<SceneData*>(a));
-                    auto itB = result.similarityScores.find(const_cast<SceneData*>(b));
-                    float simA = (itA != result.similarityScores.end()) ? itA->second : 0.0f;
-                    float simB = (itB != result.similarityScores.end()) ? itB->second : 0.0f;
+        // Sort by search relevance, then similarity score (both descending),
+        // fallback to scene ID (column indices are in ID order)
+        const auto& searchScores = query.searchScores;
+        std::vector<uint32_t> matchedIndices = m_matched;
+        std::sort(matchedIndices.begin(), matchedIndices.end(),
+            [&](uint32_t a, uint32_t b) {
+                if (!searchScores.empty()) {
+                    float searchA = searchScores.at(a);
+                    float searchB = searchScores.at(b);
+                    if (searchA != searchB) return searchA > searchB;
+                }
+                if (currentIndex) {
+                    float simA = m_similarity.at(a);
+                    float simB = m_similarity.at(b);
                     if (simA != simB) return simA > simB;
                 }
-                return a->id < b->id;
+                return a < b;
             });
 
+        result.filteredScenes.reserve(matchedIndices.size());
+        for (uint32_t index : matchedIndices) {
+            const SceneHandle handle = columns.scenes[index]->handle;
+            result.filteredScenes.push_back(handle);
+            if (!searchScores.empty()) {
+                result.searchScores[handle] = searchScores.at(index);
+            }
+            if (currentIndex) {
+                result.similarityScores[handle] = m_similarity.at(index);
+            }
+        }
+
+        m_inputs = std::move(query.inputs);
         return result;
     }
 }
@@ -3,6 +3,9 @@
 #include "PCH.h"
 #include "SceneDatabase.h"
 #include "OStimIntegration.h"
+#include "SceneIndex.h"
+#include "ThreadContext.h"
+#include <array>
 #include <vector>
 #include <string>
 #include <unordered_set>
@@ -13,6 +16,7 @@ namespace OStimNavigator {
     struct SceneFilterSettings {
         // Text filters
         const char* searchText = nullptr;
+        bool fuzzySearch = false;               // Typo-tolerant, also matches modpacks and tags; ranks by relevance
         
         // Multi-select filters
         std::unordered_set<std::string> selectedModpacks;
@@ -35,19 +39,91 @@ namespace OStimNavigator {
         bool hideIntroIdle = true;
     };
     
+    // Scenes are referenced by handle; resolve them with SceneDatabase::Resolve.
     struct SceneFilterResult {
-        std::vector<SceneData*> filteredScenes;
-        std::unordered_map<SceneData*, float> similarityScores;
+        std::vector<SceneHandle> filteredScenes;
+        std::unordered_map<SceneHandle, float> similarityScores;
+        std::unordered_map<SceneHandle, float> searchScores;   // Fuzzy search relevance
     };
     
     class SceneFilter {
     public:
         // Apply all filters to scenes and return filtered results.
-        // threadID: the OStim thread whose actors are used for compatibility checks.
+        // thread: the snapshot of the OStim thread whose actors are used for compatibility checks.
         static SceneFilterResult ApplyFilters(
-            uint32_t threadID,
-            SceneData* currentScene,
+            const ThreadContext& thread,
+            SceneHandle currentScene,
             const SceneFilterSettings& settings
         );
+
+        // Run the same filter from scratch on 1, 2, 4 ... threads up to the
+        // hardware thread count, check the results agree, and log the timings.
+        static void Benchmark(
+            const ThreadContext& thread,
+            SceneHandle currentScene,
+            const SceneFilterSettings& settings
+        );
+    };
+
+    // Filters the same thread again and again as its settings change, starting
+    // from the previous result. When a single criterion changed, a narrower
+    // setting only re-tests the scenes that still matched, and a wider one only
+    // re-tests the scenes that criterion had rejected. Anything else (another
+    // thread or actor line-up, a rebuilt catalog, several changes at once)
+    // filters the whole catalog again. Similarity scores are kept while the
+    // current scene stays the same.
+    class IncrementalSceneFilter {
+    public:
+        SceneFilterResult Apply(const ThreadContext& thread, SceneHandle currentScene, const SceneFilterSettings& settings);
+
+        // Forget the previous run; the next Apply filters everything
+        void Reset();
+
+        // Threads a run may use; 0 = ParallelSceneFilter / SceneFilterThreads
+        void SetThreads(size_t threads) { m_threads = threads; }
+
+        // Criteria, each of which rejects scenes on its own
+        enum Criterion : uint8_t {
+            kActorCount, kHiddenFlags, kFurniture, kSearch, kModpacks, kSceneTags,
+            kActions, kActionTags, kActorTags, kIntendedSex, kRequirements, kCriterionCount
+        };
+
+        // A multi-select criterion: sorted symbols, empty when off
+        struct Selection {
+            std::vector<Symbol> keys;
+            bool matchAll = false;
+
+            bool operator==(const Selection&) const = default;
+        };
+
+        // What the settings and the thread resolve to for one run
+        struct Inputs {
+            uint32_t threadID = 0;
+            uint32_t actorCount = 0;
+            std::vector<RE::Actor*> actors;
+            bool furnitureLoaded = false;
+            std::vector<Symbol> compatibleFurniture;        // Sorted
+            uint8_t hiddenFlags = 0;                        // SceneColumns::SceneFlag bits
+            std::string search;                             // Lowercase, empty when off
+            bool fuzzySearch = false;
+            Selection modpacks;                             // Never matchAll
+            Selection sceneTags;
+            Selection actorTags;
+            Selection actions;
+            Selection actionTags;
+            bool intendedSex = false;
+            bool requirements = false;
+        };
+
+    private:
+        size_t m_threads = 0;
+        bool m_valid = false;
+        uint32_t m_catalogVersion = 0;
+        Inputs m_inputs;
+        PostingList m_matched;
+        std::array<PostingList, kCriterionCount> m_rejected;   // Every other scene, by the criterion that removed it
+
+        SceneHandle m_similarityScene;
+        std::unordered_map<uint32_t, float> m_similarity;      // By SceneColumns index
     };
 }
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "PCH.h"
+#include <cstdint>
+#include <functional>
+
+/*
+ * Compact, stable references to catalog scenes.
+ *
+ * A handle packs a slot number (low 24 bits) and that slot's generation (high
+ * 8 bits) into 4 bytes. SceneDatabase gives each scene ID a slot the first time
+ * it is merged and keeps it across hot reloads of that scene, so a handle taken
+ * once stays valid while the scene exists. A full catalog load retires every
+ * slot by bumping its generation, so handles from an earlier catalog resolve to
+ * nothing instead of to whichever scene now sits in the slot. Resolving a
+ * handle is an array index and a compare. The default handle is never valid.
+ */
+
+namespace OStimNavigator {
+
+    class SceneHandle {
+    public:
+        static constexpr uint32_t kSlotBits = 24;
+        static constexpr uint32_t kMaxSlots = 1u << kSlotBits;
+
+        constexpr SceneHandle() = default;      // Invalid
+        constexpr SceneHandle(uint32_t slot, uint8_t generation)
+            : m_value(static_cast<uint32_t>(generation) << kSlotBits | (slot & (kMaxSlots - 1))) {}
+
+        uint32_t Slot() const { return m_value & (kMaxSlots - 1); }
+        uint8_t Generation() const { return static_cast<uint8_t>(m_value >> kSlotBits); }
+        uint32_t Value() const { return m_value; }
+
+        // Generations start at 1, so only the default handle has generation 0
+        explicit operator bool() const { return Generation() != 0; }
+
+        friend bool operator==(SceneHandle, SceneHandle) = default;
+
+    private:
+        uint32_t m_value = 0;
+    };
+}
+
+template <>
+struct std::hash<OStimNavigator::SceneHandle> {
+    size_t operator()(OStimNavigator::SceneHandle handle) const noexcept {
+        return std::hash<uint32_t>{}(handle.Value());
+    }
+};
@@ -0,0 +1,99 @@
+#include "SceneIdTable.h"
+#include "SceneDatabase.h"
+#include "StringUtils.h"
+#include <algorithm>
+
+namespace OStimNavigator {
+
+    namespace {
+        // Seeds tried per bucket before giving up; buckets of four into a table
+        // 25% larger than the catalog settle within a few hundred
+        constexpr uint32_t kMaxSeed = 1u << 16;
+
+        uint32_t SlotOf(uint64_t hash, uint32_t seed, size_t slotCount) {
+            // splitmix64 finalizer over the hash displaced by the seed
+            uint64_t x = hash + (static_cast<uint64_t>(seed) + 1) * 0x9E3779B97F4A7C15ull;
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+            x ^= x >> 31;
+            return static_cast<uint32_t>(x % slotCount);
+        }
+    }
+
+    bool SceneIdTable::Build(const SceneColumns& columns) {
+        m_seeds.clear();
+        m_slots.clear();
+
+        const uint32_t count = columns.Size();
+        if (count == 0) {
+            return true;
+        }
+
+        std::vector<uint64_t> hashes(count);
+        std::vector<std::vector<uint32_t>> buckets(count / 4 + 1);
+        for (uint32_t i = 0; i < count; ++i) {
+            hashes[i] = StringUtils::FoldedHash(columns.scenes[i]->id);
+            buckets[hashes[i] % buckets.size()].push_back(i);
+        }
+
+        // Largest buckets first, while the table still has room
+        std::vector<uint32_t> order(buckets.size());
+        for (uint32_t b = 0; b < order.size(); ++b) {
+            order[b] = b;
+        }
+        std::stable_sort(order.begin(), order.end(),
+            [&buckets](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+        std::vector<uint32_t> seeds(buckets.size(), 0);
+        std::vector<Slot> slots(count + count / 4 + 1);
+        std::vector<uint32_t> taken;
+        for (uint32_t b : order) {
+            const auto& bucket = buckets[b];
+            if (bucket.empty()) {
+                break;
+            }
+
+            uint32_t seed = 0;
+            for (; seed < kMaxSeed; ++seed) {
+                taken.clear();
+                bool fits = true;
+                for (uint32_t index : bucket) {
+                    const uint32_t slot = SlotOf(hashes[index], seed, slots.size());
+                    if (slots[slot].index != kEmpty || std::find(taken.begin(), taken.end(), slot) != taken.end()) {
+                        fits = false;
+                        break;
+                    }
+                    taken.push_back(slot);
+                }
+                if (fits) {
+                    break;
+                }
+            }
+            if (seed == kMaxSeed) {
+                return false;
+            }
+
+            seeds[b] = seed;
+            for (size_t i = 0; i < bucket.size(); ++i) {
+                slots[taken[i]] = { static_cast<uint32_t>(hashes[bucket[i]] >> 32), bucket[i] };
+            }
+        }
+
+        m_seeds = std::move(seeds);
+        m_slots = std::move(slots);
+        return true;
+    }
+
+    std::optional<uint32_t> SceneIdTable::Find(std::string_view id, const SceneColumns& columns) const {
+        if (m_slots.empty()) {
+            return std::nullopt;
+        }
+        const uint64_t hash = StringUtils::FoldedHash(id);
+        const Slot& slot = m_slots[SlotOf(hash, m_seeds[hash % m_seeds.size()], m_slots.size())];
+        if (slot.index == kEmpty || slot.check != static_cast<uint32_t>(hash >> 32) ||
+            !StringUtils::EqualsIgnoreCase(columns.scenes[slot.index]->id, id)) {
+            return std::nullopt;
+        }
+        return slot.index;
+    }
+}
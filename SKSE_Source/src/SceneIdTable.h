@@ -0,0 +1,45 @@
+#pragma once
+
+#include "PCH.h"
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+/*
+ * Frozen, case-insensitive lookup from scene ID to SceneColumns index.
+ *
+ * Rebuilt with SceneColumns as a perfect hash (hash and displace): IDs are
+ * spread over buckets of about four, and each bucket stores the seed that sends
+ * all of its IDs to distinct slots. A lookup hashes the ID once without
+ * copying or lowercasing it, reads its bucket's seed and one slot, and compares
+ * the ID itself only when the slot's stored hash bits match. Nothing allocates,
+ * and a miss rarely touches the scene.
+ */
+
+namespace OStimNavigator {
+
+    struct SceneColumns;
+
+    class SceneIdTable {
+    public:
+        // False, leaving the table empty, if some bucket found no working seed
+        bool Build(const SceneColumns& columns);
+
+        // columns must be the ones the table was built from
+        std::optional<uint32_t> Find(std::string_view id, const SceneColumns& columns) const;
+
+        bool Empty() const { return m_slots.empty(); }
+
+    private:
+        static constexpr uint32_t kEmpty = ~0u;
+
+        struct Slot {
+            uint32_t check = 0;                 // High half of the ID's hash
+            uint32_t index = kEmpty;            // SceneColumns index
+        };
+
+        std::vector<uint32_t> m_seeds;          // Per bucket
+        std::vector<Slot> m_slots;
+    };
+}
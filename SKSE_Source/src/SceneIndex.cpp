@@ -0,0 +1,100 @@
+#include "SceneIndex.h"
+#include "SceneDatabase.h"
+#include "ActionDatabase.h"
+#include <algorithm>
+
+namespace OStimNavigator {
+
+    namespace {
+        // Scenes are visited in index order, so appending keeps every list
+        // sorted; the back() check drops repeats within one scene.
+        void Add(PostingList& list, uint32_t index) {
+            if (list.empty() || list.back() != index) {
+                list.push_back(index);
+            }
+        }
+    }
+
+    PostingList Intersect(const PostingList& a, const PostingList& b) {
+        PostingList result;
+        result.reserve(std::min(a.size(), b.size()));
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(result));
+        return result;
+    }
+
+    void SceneIndexes::Build(const SceneColumns& columns) {
+        *this = {};
+        auto& actionDB = ActionDatabase::GetSingleton();
+        const Symbol male = Symbol::Intern("male");
+        const Symbol female = Symbol::Intern("female");
+
+        for (uint32_t i = 0; i < columns.Size(); ++i) {
+            Add(actorCounts[columns.actorCount[i]], i);
+            Add(modpacks[columns.modpack[i]], i);
+            Add(furnitureTypes[columns.furnitureType[i]], i);
+            ++flagCounts[columns.flags[i]];
+
+            for (Symbol tag : columns.Tags(i)) {
+                Add(sceneTags[tag], i);
+            }
+            for (const auto& action : columns.Actions(i)) {
+                Add(actions[action.type], i);
+                if (const ActionData* data = actionDB.GetAction(action.type)) {
+                    for (Symbol tag : data->tags) {
+                        Add(actionTags[tag], i);
+                    }
+                }
+            }
+            if (!columns.RequirementMasks(i).empty()) {
+                ++requirementScenes;
+            }
+
+            for (uint32_t actor = columns.actorOffsets[i]; actor < columns.actorOffsets[i + 1]; ++actor) {
+                for (Symbol tag : columns.ActorTags(actor)) {
+                    Add(actorTags[tag], i);
+                }
+
+                const uint32_t slot = actor - columns.actorOffsets[i];
+                if (slot >= intendedMale.size()) {
+                    intendedMale.resize(slot + 1, 0);
+                    intendedFemale.resize(slot + 1, 0);
+                }
+                if (columns.actorSex[actor] == male) {
+                    ++intendedMale[slot];
+                } else if (columns.actorSex[actor] == female) {
+                    ++intendedFemale[slot];
+                }
+            }
+        }
+    }
+
+    PostingList SceneIndexes::Match(const SymbolIndex& index, std::span<const Symbol> keys, bool matchAll) {
+        std::vector<const PostingList*> lists;
+        lists.reserve(keys.size());
+        for (Symbol key : keys) {
+            lists.push_back(&Find(index, key));
+        }
+        if (lists.empty()) {
+            return {};
+        }
+
+        if (matchAll) {
+            // Smallest first, so every step shrinks the working set fastest
+            std::sort(lists.begin(), lists.end(),
+                [](const PostingList* a, const PostingList* b) { return a->size() < b->size(); });
+            PostingList result = *lists.front();
+            for (size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+                result = Intersect(result, *lists[i]);
+            }
+            return result;
+        }
+
+        PostingList result;
+        for (const PostingList* list : lists) {
+            result.insert(result.end(), list->begin(), list->end());
+        }
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "PCH.h"
+#include "SymbolTable.h"
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Inverted indexes over the columnar catalog.
+ *
+ * Each index maps a value (a tag, action type, modpack, ...) to the sorted
+ * SceneColumns indices of the scenes that carry it. A multi-criterion query
+ * intersects and unites these lists, so only scenes that pass every indexed
+ * criterion are looked at. Built together with SceneColumns and replaced
+ * whenever the catalog changes.
+ */
+
+namespace OStimNavigator {
+
+    struct SceneColumns;
+
+    // Sorted, duplicate-free scene indices
+    using PostingList = std::vector<uint32_t>;
+
+    PostingList Intersect(const PostingList& a, const PostingList& b);
+
+    struct SceneIndexes {
+        using SymbolIndex = std::unordered_map<Symbol, PostingList>;
+
+        SymbolIndex sceneTags;
+        SymbolIndex actorTags;                  // Scenes where at least one actor has the tag
+        SymbolIndex actions;                    // Resolved action types
+        SymbolIndex actionTags;                 // Tags of the scene's actions (from ActionDatabase)
+        SymbolIndex modpacks;
+        SymbolIndex furnitureTypes;             // Includes the empty symbol (no furniture)
+        std::unordered_map<uint32_t, PostingList> actorCounts;
+
+        // Statistics for query planning
+        std::unordered_map<uint8_t, uint32_t> flagCounts;   // Scenes per SceneFlag combination
+        std::vector<uint32_t> intendedMale;                 // Scenes whose actor i is intended male
+        std::vector<uint32_t> intendedFemale;
+        uint32_t requirementScenes = 0;                     // Scenes with an action that has role requirements
+
+        void Build(const SceneColumns& columns);
+
+        // The scenes with key, or an empty list
+        template <typename Index>
+        static const PostingList& Find(const Index& index, const typename Index::key_type& key) {
+            static const PostingList empty;
+            auto it = index.find(key);
+            return it != index.end() ? it->second : empty;
+        }
+
+        // The scenes with all of the keys (matchAll) or any of them
+        static PostingList Match(const SymbolIndex& index, std::span<const Symbol> keys, bool matchAll);
+    };
+}
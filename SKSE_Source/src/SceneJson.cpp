@@ -0,0 +1,352 @@
+#include "SceneJson.h"
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+
+namespace OStimNavigator {
+    namespace SceneJson {
+
+        namespace {
+            using json = nlohmann::json;
+
+            // Where the handler currently is inside the scene document.
+            enum class Context : uint8_t {
+                Top,            // Root object
+                Speeds,         // "speeds" array
+                FirstSpeed,     // speeds[0] object
+                Actors,         // "actors" array
+                Actor,          // actors[i] object
+                ActorTags,      // actors[i].tags array
+                Tags,           // "tags" array
+                Actions,        // "actions" array
+                Action          // actions[i] object
+            };
+
+            // Object keys the reader cares about; everything else is skipped.
+            enum class Field : uint8_t {
+                Other,
+                Name, Modpack, ModPack, Length, NoRandomSelection, Furniture, Destination,
+                Speeds, Actors, Tags, Actions,
+                Animation,
+                IntendedSex, AnimationIndex,
+                Type, Actor, Target, Performer
+            };
+
+            Field TopField(std::string_view key) {
+                if (key == "name") return Field::Name;
+                if (key == "modpack") return Field::Modpack;
+                if (key == "modPack") return Field::ModPack;
+                if (key == "length") return Field::Length;
+                if (key == "noRandomSelection") return Field::NoRandomSelection;
+                if (key == "furniture") return Field::Furniture;
+                if (key == "destination") return Field::Destination;
+                if (key == "speeds") return Field::Speeds;
+                if (key == "actors") return Field::Actors;
+                if (key == "tags") return Field::Tags;
+                if (key == "actions") return Field::Actions;
+                return Field::Other;
+            }
+
+            Field ActorField(std::string_view key) {
+                if (key == "intendedSex") return Field::IntendedSex;
+                if (key == "animationIndex") return Field::AnimationIndex;
+                if (key == "tags") return Field::Tags;
+                return Field::Other;
+            }
+
+            Field ActionField(std::string_view key) {
+                if (key == "type") return Field::Type;
+                if (key == "actor") return Field::Actor;
+                if (key == "target") return Field::Target;
+                if (key == "performer") return Field::Performer;
+                return Field::Other;
+            }
+
+            class SceneSaxHandler final : public nlohmann::json_sax<json> {
+            public:
+                explicit SceneSaxHandler(SceneFields& out) : m_out(out) {}
+
+                bool null() override {
+                    return Scalar([](Value& v) { v.kind = Value::Kind::Null; });
+                }
+                bool boolean(bool val) override {
+                    return Scalar([val](Value& v) { v.kind = Value::Kind::Boolean; v.boolean = val; });
+                }
+                bool number_integer(number_integer_t val) override {
+                    return Scalar([val](Value& v) { v.kind = Value::Kind::Integer; v.integer = val; });
+                }
+                bool number_unsigned(number_unsigned_t val) override {
+                    return Scalar([val](Value& v) { v.kind = Value::Kind::Unsigned; v.unsignedInteger = val; });
+                }
+                bool number_float(number_float_t val, const string_t&) override {
+                    return Scalar([val](Value& v) { v.kind = Value::Kind::Float; v.number = val; });
+                }
+                bool string(string_t& val) override {
+                    return Scalar([&val](Value& v) { v.kind = Value::Kind::String; v.string = std::move(val); });
+                }
+                bool binary(binary_t&) override {
+                    return Scalar([](Value&) {});
+                }
+
+                bool start_object(std::size_t) override {
+                    if (m_skipDepth > 0) {
+                        ++m_skipDepth;
+                        return true;
+                    }
+
+                    Value* slot = Slot();
+                    if (slot) {
+                        *slot = Value{};
+                        slot->kind = Value::Kind::Object;
+                    }
+
+                    if (m_stack.empty()) {
+                        m_out.isObject = true;
+                        m_stack.push_back({ Context::Top });
+                    } else if (Top().context == Context::Speeds && Top().index == 0) {
+                        m_out.firstSpeedAnimation = Value{};
+                        m_stack.push_back({ Context::FirstSpeed });
+                    } else if (Top().context == Context::Actors) {
+                        m_stack.push_back({ Context::Actor });
+                    } else if (Top().context == Context::Actions) {
+                        m_stack.push_back({ Context::Action });
+                    } else {
+                        m_skipDepth = 1;
+                    }
+                    return true;
+                }
+
+                bool key(string_t& val) override {
+                    if (m_skipDepth > 0) {
+                        return true;
+                    }
+                    Frame& frame = Top();
+                    switch (frame.context) {
+                    case Context::Top:        frame.field = TopField(val); break;
+                    case Context::FirstSpeed: frame.field = val == "animation" ? Field::Animation : Field::Other; break;
+                    case Context::Actor:      frame.field = ActorField(val); break;
+                    case Context::Action:     frame.field = ActionField(val); break;
+                    default:                  frame.field = Field::Other; break;
+                    }
+                    return true;
+                }
+
+                bool end_object() override {
+                    return EndContainer();
+                }
+
+                bool start_array(std::size_t) override {
+                    if (m_skipDepth > 0) {
+                        ++m_skipDepth;
+                        return true;
+                    }
+
+                    Value* slot = Slot();
+                    if (slot) {
+                        *slot = Value{};
+                        slot->kind = Value::Kind::Array;
+                    }
+
+                    // Duplicate keys: the last occurrence wins, as in the DOM.
+                    if (m_stack.empty()) {
+                        m_skipDepth = 1;
+                    } else if (Top().context == Context::Top && Top().field == Field::Speeds) {
+                        m_out.speedCount = 0;
+                        m_out.firstSpeed = Value{};
+                        m_out.firstSpeedAnimation = Value{};
+                        m_stack.push_back({ Context::Speeds });
+                    } else if (Top().context == Context::Top && Top().field == Field::Actors) {
+                        m_out.actorValues.clear();
+                        m_stack.push_back({ Context::Actors });
+                    } else if (Top().context == Context::Top && Top().field == Field::Tags) {
+                        m_out.tagValues.clear();
+                        m_stack.push_back({ Context::Tags });
+                    } else if (Top().context == Context::Top && Top().field == Field::Actions) {
+                        m_out.actionValues.clear();
+                        m_stack.push_back({ Context::Actions });
+                    } else if (Top().context == Context::Actor && Top().field == Field::Tags) {
+                        m_out.actorValues.back().tagValues.clear();
+                        m_stack.push_back({ Context::ActorTags });
+                    } else {
+                        m_skipDepth = 1;
+                    }
+                    return true;
+                }
+
+                bool end_array() override {
+                    return EndContainer();
+                }
+
+                bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+                    throw std::runtime_error(ex.what());
+                }
+
+            private:
+                struct Frame {
+                    Context context;
+                    Field field = Field::Other;     // Pending key (object contexts)
+                    size_t index = 0;               // Next element index (array contexts)
+                };
+
+                Frame& Top() { return m_stack.back(); }
+
+                template <typename Assign>
+                bool Scalar(Assign assign) {
+                    if (m_skipDepth > 0) {
+                        return true;
+                    }
+                    if (Value* slot = Slot()) {
+                        *slot = Value{};
+                        assign(*slot);
+                    }
+                    ValueDone();
+                    return true;
+                }
+
+                // Destination for the value that is about to start, or nullptr if
+                // the value is not captured. Array contexts append a new element.
+                Value* Slot() {
+                    if (m_stack.empty()) {
+                        return nullptr;
+                    }
+                    Frame& frame = Top();
+                    switch (frame.context) {
+                    case Context::Top:
+                        switch (frame.field) {
+                        case Field::Name:              return &m_out.name;
+                        case Field::Modpack:           return &m_out.modpack;
+                        case Field::ModPack:           return &m_out.modPack;
+                        case Field::Length:            return &m_out.length;
+                        case Field::NoRandomSelection: return &m_out.noRandomSelection;
+                        case Field::Furniture:         return &m_out.furniture;
+                        case Field::Destination:       return &m_out.destination;
+                        case Field::Speeds:            return &m_out.speeds;
+                        case Field::Actors:            return &m_out.actors;
+                        case Field::Tags:              return &m_out.tags;
+                        case Field::Actions:           return &m_out.actions;
+                        default:                       return nullptr;
+                        }
+                    case Context::Speeds:
+                        return frame.index == 0 ? &m_out.firstSpeed : nullptr;
+                    case Context::FirstSpeed:
+                        return frame.field == Field::Animation ? &m_out.firstSpeedAnimation : nullptr;
+                    case Context::Actors:
+                        return &m_out.actorValues.emplace_back().self;
+                    case Context::Actor: {
+                        ActorFields& actor = m_out.actorValues.back();
+                        switch (frame.field) {
+                        case Field::IntendedSex:    return &actor.intendedSex;
+                        case Field::AnimationIndex: return &actor.animationIndex;
+                        case Field::Tags:           return &actor.tags;
+                        default:                    return nullptr;
+                        }
+                    }
+                    case Context::ActorTags:
+                        return &m_out.actorValues.back().tagValues.emplace_back();
+                    case Context::Tags:
+                        return &m_out.tagValues.emplace_back();
+                    case Context::Actions:
+                        return &m_out.actionValues.emplace_back().self;
+                    case Context::Action: {
+                        ActionFields& action = m_out.actionValues.back();
+                        switch (frame.field) {
+                        case Field::Type:      return &action.type;
+                        case Field::Actor:     return &action.actor;
+                        case Field::Target:    return &action.target;
+                        case Field::Performer: return &action.performer;
+                        default:               return nullptr;
+                        }
+                    }
+                    }
+                    return nullptr;
+                }
+
+                // A complete value was consumed in the current container.
+                void ValueDone() {
+                    if (m_stack.empty()) {
+                        return;
+                    }
+                    Frame& frame = Top();
+                    if (frame.context == Context::Speeds) {
+                        ++m_out.speedCount;
+                    }
+                    ++frame.index;
+                }
+
+                bool EndContainer() {
+                    if (m_skipDepth > 0) {
+                        if (--m_skipDepth == 0) {
+                            ValueDone();
+                        }
+                        return true;
+                    }
+                    m_stack.pop_back();
+                    ValueDone();
+                    return true;
+                }
+
+                SceneFields& m_out;
+                std::vector<Frame> m_stack;
+                size_t m_skipDepth = 0;
+            };
+        }
+
+        void Read(std::string_view content, SceneFields& out) {
+            SceneSaxHandler handler(out);
+            json::sax_parse(content.begin(), content.end(), &handler);
+        }
+
+        const char* KindName(Value::Kind kind) {
+            switch (kind) {
+            case Value::Kind::Null:     return "null";
+            case Value::Kind::Boolean:  return "boolean";
+            case Value::Kind::Integer:
+            case Value::Kind::Unsigned:
+            case Value::Kind::Float:    return "number";
+            case Value::Kind::String:   return "string";
+            case Value::Kind::Object:   return "object";
+            case Value::Kind::Array:    return "array";
+            default:                    return "missing";
+            }
+        }
+
+        namespace {
+            [[noreturn]] void TypeError(std::string_view field, const char* expected, const Value& value) {
+                throw std::runtime_error(std::string(field) + ": type must be " + expected +
+                                         ", but is " + KindName(value.kind));
+            }
+
+            template <typename T>
+            T AsArithmetic(const Value& value, std::string_view field) {
+                switch (value.kind) {
+                case Value::Kind::Integer:  return static_cast<T>(value.integer);
+                case Value::Kind::Unsigned: return static_cast<T>(value.unsignedInteger);
+                case Value::Kind::Float:    return static_cast<T>(value.number);
+                case Value::Kind::Boolean:  return static_cast<T>(value.boolean);
+                default:                    TypeError(field, "number", value);
+                }
+            }
+        }
+
+        std::string AsString(const Value& value, std::string_view field) {
+            if (value.kind != Value::Kind::String) {
+                TypeError(field, "string", value);
+            }
+            return value.string;
+        }
+
+        float AsFloat(const Value& value, std::string_view field) {
+            return AsArithmetic<float>(value, field);
+        }
+
+        int AsInt(const Value& value, std::string_view field) {
+            return AsArithmetic<int>(value, field);
+        }
+
+        bool AsBool(const Value& value, std::string_view field) {
+            if (value.kind != Value::Kind::Boolean) {
+                TypeError(field, "boolean", value);
+            }
+            return value.boolean;
+        }
+    }
+}
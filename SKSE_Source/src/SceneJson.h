@@ -0,0 +1,96 @@
+#pragma once
+
+#include "PCH.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Streaming reader for OStim scene files.
+ *
+ * Scene files are parsed with an nlohmann SAX handler that captures only the
+ * fields SceneDatabase reads and skips every other subtree (speeds beyond the
+ * first, per-speed offsets, navigation, autotransitions, ...) without building
+ * a DOM. The typed accessors follow nlohmann's get<T>() conversion rules so a
+ * scene parses to exactly what the DOM path produced, including which files
+ * fail and at which point.
+ */
+
+namespace OStimNavigator {
+    namespace SceneJson {
+
+        // A captured JSON value. Objects and arrays only record their kind.
+        struct Value {
+            enum class Kind : uint8_t { Missing, Null, Boolean, Integer, Unsigned, Float, String, Object, Array };
+
+            Kind kind = Kind::Missing;
+            bool boolean = false;
+            int64_t integer = 0;
+            uint64_t unsignedInteger = 0;
+            double number = 0.0;
+            std::string string;
+
+            bool Has() const { return kind != Kind::Missing; }
+            bool IsString() const { return kind == Kind::String; }
+            bool IsArray() const { return kind == Kind::Array; }
+            bool IsObject() const { return kind == Kind::Object; }
+        };
+
+        struct ActorFields {
+            Value self;                 // Kind of the array element itself
+            Value intendedSex;
+            Value animationIndex;
+            Value tags;                 // Kind of "tags"; elements below
+            std::vector<Value> tagValues;
+        };
+
+        struct ActionFields {
+            Value self;                 // Kind of the array element itself
+            Value type;
+            Value actor;
+            Value target;
+            Value performer;
+        };
+
+        struct SceneFields {
+            bool isObject = false;      // Top-level value is an object
+
+            Value name;
+            Value modpack;
+            Value modPack;
+            Value length;
+            Value noRandomSelection;
+            Value furniture;
+            Value destination;
+
+            Value speeds;
+            size_t speedCount = 0;
+            Value firstSpeed;           // Kind of speeds[0]
+            Value firstSpeedAnimation;  // speeds[0].animation
+
+            Value actors;
+            std::vector<ActorFields> actorValues;
+
+            Value tags;
+            std::vector<Value> tagValues;
+
+            Value actions;
+            std::vector<ActionFields> actionValues;
+        };
+
+        // Parse a whole scene file. Throws std::runtime_error on malformed JSON
+        // (same syntax rules as nlohmann::json::parse).
+        void Read(std::string_view content, SceneFields& out);
+
+        // Conversions matching nlohmann's get<T>(). Throw std::runtime_error
+        // naming the field when the value has an incompatible type.
+        std::string AsString(const Value& value, std::string_view field);
+        float AsFloat(const Value& value, std::string_view field);
+        int AsInt(const Value& value, std::string_view field);
+        bool AsBool(const Value& value, std::string_view field);
+
+        // nlohmann's type_name() for error messages
+        const char* KindName(Value::Kind kind);
+    }
+}
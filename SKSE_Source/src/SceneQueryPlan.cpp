@@ -0,0 +1,172 @@
+#include "SceneQueryPlan.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+namespace OStimNavigator {
+
+    namespace {
+        // Filter work (cost x candidates) worth one parallel chunk; below two
+        // chunks' worth, handing out the work costs more than it saves
+        constexpr double kMinChunkWork = 4096.0;
+        constexpr size_t kChunksPerThread = 4;  // Evens out chunks that filter slower
+
+        // How a stage was evaluated, for explain output
+        struct StageReport {
+            const char* name;
+            const char* method;
+            double estimate;
+            size_t survivors;
+            long long micros;
+        };
+
+        long long MicrosSince(std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        PostingList Difference(const PostingList& a, const PostingList& b) {
+            PostingList result;
+            std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(result));
+            return result;
+        }
+    }
+
+    size_t SceneQueryPlan::Add(std::string name, double estimate, double cost, Lookup lookup, Filter filter) {
+        m_predicates.push_back({ std::move(name), std::clamp(estimate, 0.0, static_cast<double>(m_sceneCount)), cost,
+                                 std::move(lookup), std::move(filter) });
+        return m_predicates.size() - 1;
+    }
+
+    double SceneQueryPlan::Rank(const Predicate& predicate) const {
+        const double selectivity = m_sceneCount > 0 ? predicate.estimate / m_sceneCount : 1.0;
+        return predicate.cost / std::max(1.0 - selectivity, 1e-6);
+    }
+
+    void SceneQueryPlan::RunFilter(const Predicate& predicate, PostingList& candidates) const {
+        const double work = predicate.cost * static_cast<double>(candidates.size());
+        const size_t chunkCount = std::min(m_threads * kChunksPerThread, static_cast<size_t>(work / kMinChunkWork));
+        if (m_threads <= 1 || chunkCount < 2) {
+            predicate.filter(candidates);
+            return;
+        }
+
+        // Contiguous chunks keep index order, so joining them in order is stable
+        std::vector<PostingList> chunks(chunkCount);
+        const size_t chunkSize = (candidates.size() + chunkCount - 1) / chunkCount;
+        WorkerPool::GetSingleton().ParallelFor(chunkCount, m_threads, [&](size_t chunk) {
+            const size_t begin = std::min(chunk * chunkSize, candidates.size());
+            const size_t end = std::min(begin + chunkSize, candidates.size());
+            chunks[chunk].assign(candidates.begin() + begin, candidates.begin() + end);
+            predicate.filter(chunks[chunk]);
+        });
+
+        candidates.clear();
+        for (const PostingList& chunk : chunks) {
+            candidates.insert(candidates.end(), chunk.begin(), chunk.end());
+        }
+    }
+
+    PostingList SceneQueryPlan::Execute(bool explain, std::vector<PostingList>* rejected) const {
+        // Candidates come from the most selective lookup
+        const Predicate* driver = nullptr;
+        for (const Predicate& predicate : m_predicates) {
+            if (predicate.lookup && (!driver || predicate.estimate < driver->estimate)) {
+                driver = &predicate;
+            }
+        }
+
+        PostingList candidates(m_sceneCount);
+        std::iota(candidates.begin(), candidates.end(), 0u);
+        if (rejected) {
+            rejected->assign(m_predicates.size(), {});
+        }
+        const auto start = std::chrono::steady_clock::now();
+        if (driver) {
+            PostingList matches = driver->lookup();
+            if (rejected) {
+                (*rejected)[driver - m_predicates.data()] = Difference(candidates, matches);
+            }
+            candidates = std::move(matches);
+        }
+        return Run(driver, std::move(candidates), explain, rejected, MicrosSince(start));
+    }
+
+    PostingList SceneQueryPlan::Refine(PostingList candidates, bool explain, std::vector<PostingList>* rejected) const {
+        if (rejected) {
+            rejected->assign(m_predicates.size(), {});
+        }
+        return Run(nullptr, std::move(candidates), explain, rejected, 0);
+    }
+
+    PostingList SceneQueryPlan::Apply(size_t predicate, PostingList& candidates) const {
+        const Predicate& stage = m_predicates[predicate];
+        PostingList before = candidates;
+        if (stage.filter) {
+            RunFilter(stage, candidates);
+        } else {
+            candidates = Intersect(candidates, stage.lookup());
+        }
+        return Difference(before, candidates);
+    }
+
+    PostingList SceneQueryPlan::Run(const Predicate* driver, PostingList candidates, bool explain,
+                                    std::vector<PostingList>* rejected, long long driverMicros) const {
+        std::vector<const Predicate*> stages;
+        for (const Predicate& predicate : m_predicates) {
+            if (&predicate != driver) {
+                stages.push_back(&predicate);
+            }
+        }
+        std::stable_sort(stages.begin(), stages.end(),
+            [this](const Predicate* a, const Predicate* b) { return Rank(*a) < Rank(*b); });
+
+        std::vector<StageReport> reports;
+        if (explain) {
+            reports.push_back({ driver ? driver->name.c_str() : "candidates", driver ? "lookup" : "given",
+                                driver ? driver->estimate : static_cast<double>(candidates.size()), candidates.size(), driverMicros });
+        }
+
+        size_t evaluated = 0;
+        PostingList before;
+        for (const Predicate* stage : stages) {
+            if (candidates.empty()) break;
+            const auto start = std::chrono::steady_clock::now();
+            if (rejected) {
+                before = candidates;
+            }
+
+            // Intersecting walks both lists; filtering tests every candidate
+            const double lookupCost = stage->estimate + static_cast<double>(candidates.size());
+            const double filterCost = stage->cost * static_cast<double>(candidates.size());
+            const bool useLookup = stage->lookup && (!stage->filter || lookupCost < filterCost);
+            if (useLookup) {
+                candidates = Intersect(candidates, stage->lookup());
+            } else {
+                RunFilter(*stage, candidates);
+            }
+            ++evaluated;
+
+            if (rejected) {
+                (*rejected)[stage - m_predicates.data()] = Difference(before, candidates);
+            }
+            if (explain) {
+                reports.push_back({ stage->name.c_str(), useLookup ? "lookup" : "filter",
+                                    stage->estimate, candidates.size(), MicrosSince(start) });
+            }
+        }
+
+        if (explain) {
+            SKSE::log::info("Filter plan over {} scenes ({} predicates, {} thread(s)):", m_sceneCount, m_predicates.size(), m_threads);
+            for (size_t i = 0; i < reports.size(); ++i) {
+                const StageReport& report = reports[i];
+                SKSE::log::info("  {}. {:<16} {:<6} est {:>7.0f} -> {:>6} ({} us)",
+                    i + 1, report.name, report.method, report.estimate, report.survivors, report.micros);
+            }
+            for (size_t i = evaluated; i < stages.size(); ++i) {
+                SKSE::log::info("  -  {:<16} skipped, no candidates left", stages[i]->name);
+            }
+        }
+        return candidates;
+    }
+}
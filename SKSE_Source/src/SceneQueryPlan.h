@@ -0,0 +1,89 @@
+#pragma once
+
+#include "PCH.h"
+#include "SceneIndex.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+ * Filter query plans.
+ *
+ * A plan is a set of predicates over SceneColumns indices. Each one carries an
+ * estimate of how many scenes pass it, taken from index statistics, and the
+ * relative cost of testing one candidate against it. A predicate can offer a
+ * lookup (the sorted list of every scene that passes, from an index), a filter
+ * (drops failing scenes from a candidate list), or both.
+ *
+ * Execute generates candidates from the lookup with the fewest estimated
+ * scenes, then applies the remaining predicates in order of cost per rejected
+ * scene, cost / (1 - selectivity), so cheap and selective ones go first. Each
+ * of those is intersected with its lookup when that is cheaper than testing
+ * every remaining candidate, and filtered otherwise. Execution stops as soon
+ * as no candidates are left. With explain set, the chosen plan and the number
+ * of scenes surviving each stage are logged.
+ *
+ * Callers that refine a previous result ask for the scenes each predicate
+ * rejected, and use Refine and Apply to re-test just part of the catalog.
+ *
+ * With more than one thread, a filter over enough candidates is run on
+ * contiguous chunks of them in the WorkerPool, and the surviving chunks are
+ * joined back in order, so the result is the same as on one thread. Filters
+ * must therefore only read shared state.
+ */
+
+namespace OStimNavigator {
+
+    class SceneQueryPlan {
+    public:
+        using Lookup = std::function<PostingList()>;
+        using Filter = std::function<void(PostingList&)>;
+
+        explicit SceneQueryPlan(uint32_t sceneCount) : m_sceneCount(sceneCount) {}
+
+        // estimate: scenes expected to pass (an upper bound is fine)
+        // cost: relative cost of filtering one candidate (a column compare is 1)
+        // Returns the predicate's number, counted from 0 in Add order.
+        size_t Add(std::string name, double estimate, double cost, Lookup lookup, Filter filter);
+
+        size_t Size() const { return m_predicates.size(); }
+
+        // Threads filters may use, the caller's included (1 = serial)
+        void SetThreads(size_t threads) { m_threads = threads > 0 ? threads : 1; }
+
+        // The scenes that pass every predicate, in index order. If rejected is
+        // given it receives one list per predicate, holding the scenes that
+        // predicate removed; with the result they cover every scene once.
+        PostingList Execute(bool explain, std::vector<PostingList>* rejected = nullptr) const;
+
+        // Like Execute, but starting from candidates instead of an index lookup
+        PostingList Refine(PostingList candidates, bool explain, std::vector<PostingList>* rejected = nullptr) const;
+
+        // Remove the candidates that fail one predicate and return them
+        PostingList Apply(size_t predicate, PostingList& candidates) const;
+
+    private:
+        struct Predicate {
+            std::string name;
+            double estimate;
+            double cost;
+            Lookup lookup;
+            Filter filter;
+        };
+
+        double Rank(const Predicate& predicate) const;
+
+        // Run a predicate's filter, split across threads when there is enough work
+        void RunFilter(const Predicate& predicate, PostingList& candidates) const;
+
+        // Apply every predicate but driver to candidates, which driver (or the
+        // caller, without one) produced
+        PostingList Run(const Predicate* driver, PostingList candidates, bool explain,
+                        std::vector<PostingList>* rejected, long long driverMicros) const;
+
+        uint32_t m_sceneCount;
+        size_t m_threads = 1;
+        std::vector<Predicate> m_predicates;
+    };
+}
@@ -0,0 +1,242 @@
+#include "SceneSearchIndex.h"
+#include "SceneDatabase.h"
+#include "StringUtils.h"
+#include <algorithm>
+
+namespace OStimNavigator {
+
+    namespace {
+        uint32_t Trigram(std::string_view text, size_t pos) {
+            return static_cast<uint32_t>(static_cast<uint8_t>(text[pos])) << 16 |
+                   static_cast<uint32_t>(static_cast<uint8_t>(text[pos + 1])) << 8 |
+                   static_cast<uint32_t>(static_cast<uint8_t>(text[pos + 2]));
+        }
+
+        // Field weights: a hit in the name counts most
+        constexpr float kNameWeight = 1.0f;
+        constexpr float kIdWeight = 0.9f;
+        constexpr float kModpackWeight = 0.85f;
+        constexpr float kTagWeight = 0.75f;
+
+        // Typos tolerated for a query of this length
+        uint32_t MaxEdits(size_t length) {
+            return length <= 4 ? 0 : length <= 8 ? 1 : 2;
+        }
+
+        bool IsWordChar(char c) {
+            return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+        }
+
+        // Fewest edits that turn query into some substring of text, capped at
+        // maxEdits + 1 (Sellers' variant of the edit-distance table)
+        uint32_t SubstringDistance(std::string_view query, std::string_view text, uint32_t maxEdits) {
+            thread_local std::vector<uint32_t> column;
+            const size_t m = query.size();
+            column.resize(m + 1);
+            for (size_t i = 0; i <= m; ++i) {
+                column[i] = static_cast<uint32_t>(i);
+            }
+
+            uint32_t best = column[m];
+            for (char c : text) {
+                uint32_t diagonal = 0;          // A match may start anywhere in text
+                for (size_t i = 1; i <= m; ++i) {
+                    const uint32_t left = column[i];
+                    column[i] = std::min({ left + 1, column[i - 1] + 1, diagonal + (query[i - 1] == c ? 0u : 1u) });
+                    diagonal = left;
+                }
+                best = std::min(best, column[m]);
+                if (best == 0) break;
+            }
+            return std::min(best, maxEdits + 1);
+        }
+
+        // How well one lowercase field matches the lowercase query (0 = no match)
+        float FieldScore(std::string_view text, std::string_view query, uint32_t maxEdits) {
+            const size_t pos = text.find(query);
+            if (pos != std::string_view::npos) {
+                if (text.size() == query.size()) return 1.0f;
+                if (pos == 0 || !IsWordChar(text[pos - 1])) return 0.95f;
+                return 0.9f;
+            }
+            if (maxEdits == 0) {
+                return 0.0f;
+            }
+            const uint32_t edits = SubstringDistance(query, text, maxEdits);
+            return edits <= maxEdits ? 0.8f - 0.2f * static_cast<float>(edits - 1) : 0.0f;
+        }
+
+        void AddTrigrams(std::unordered_map<uint32_t, PostingList>& trigrams, std::string_view text, uint32_t index) {
+            for (size_t pos = 0; pos + 3 <= text.size(); ++pos) {
+                // Scenes are added in index order, so lists stay sorted
+                PostingList& list = trigrams[Trigram(text, pos)];
+                if (list.empty() || list.back() != index) {
+                    list.push_back(index);
+                }
+            }
+        }
+    }
+
+    void SceneSearchIndex::Build(const SceneColumns& columns, const SceneIndexes& indexes) {
+        m_names.clear();
+        m_ids.clear();
+        m_trigrams.clear();
+        m_terms.clear();
+        m_names.reserve(columns.Size());
+        m_ids.reserve(columns.Size());
+
+        for (uint32_t i = 0; i < columns.Size(); ++i) {
+            const SceneData* scene = columns.scenes[i];
+            m_names.push_back(StringUtils::ToLowerCopy(scene->name));
+            m_ids.push_back(StringUtils::ToLowerCopy(scene->id));
+            AddTrigrams(m_trigrams, m_names.back(), i);
+            AddTrigrams(m_trigrams, m_ids.back(), i);
+        }
+
+        for (const auto& [modpack, scenes] : indexes.modpacks) {
+            if (!modpack.empty()) {
+                m_terms.push_back({ StringUtils::ToLowerCopy(modpack.str()), kModpackWeight, scenes });
+            }
+        }
+        for (const auto& [tag, scenes] : indexes.sceneTags) {
+            m_terms.push_back({ StringUtils::ToLowerCopy(tag.str()), kTagWeight, scenes });
+        }
+    }
+
+    PostingList SceneSearchIndex::Search(std::string_view query, bool includeIds) const {
+        std::string lowerQuery(query);
+        StringUtils::ToLower(lowerQuery);
+
+        auto matches = [&](uint32_t index) {
+            return m_names[index].find(lowerQuery) != std::string::npos ||
+                   (includeIds && m_ids[index].find(lowerQuery) != std::string::npos);
+        };
+
+        PostingList result;
+        if (lowerQuery.size() < 3) {
+            for (uint32_t i = 0; i < m_names.size(); ++i) {
+                if (matches(i)) result.push_back(i);
+            }
+            return result;
+        }
+
+        // Every trigram of the query must occur in a matching scene
+        std::vector<const PostingList*> lists;
+        for (size_t pos = 0; pos + 3 <= lowerQuery.size(); ++pos) {
+            auto it = m_trigrams.find(Trigram(lowerQuery, pos));
+            if (it == m_trigrams.end()) {
+                return result;
+            }
+            lists.push_back(&it->second);
+        }
+        // Smallest first; repeated trigrams sort next to each other and are dropped
+        std::sort(lists.begin(), lists.end(), [](const PostingList* a, const PostingList* b) {
+            return a->size() != b->size() ? a->size() < b->size() : std::less<>{}(a, b);
+        });
+        lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+
+        PostingList candidates = *lists.front();
+        for (size_t i = 1; i < lists.size() && !candidates.empty(); ++i) {
+            candidates = Intersect(candidates, *lists[i]);
+        }
+
+        // A scene can have every trigram without the whole query, or have it
+        // only in its ID when includeIds is false
+        for (uint32_t index : candidates) {
+            if (matches(index)) result.push_back(index);
+        }
+        return result;
+    }
+
+    size_t SceneSearchIndex::EstimateMatches(std::string_view query) const {
+        std::string lowerQuery(query);
+        StringUtils::ToLower(lowerQuery);
+
+        size_t estimate = m_names.size();
+        for (size_t pos = 0; pos + 3 <= lowerQuery.size(); ++pos) {
+            auto it = m_trigrams.find(Trigram(lowerQuery, pos));
+            if (it == m_trigrams.end()) {
+                return 0;
+            }
+            estimate = std::min(estimate, it->second.size());
+        }
+        return estimate;
+    }
+
+    std::vector<SceneSearchIndex::Hit> SceneSearchIndex::FuzzySearch(std::string_view query, size_t maxResults) const {
+        std::string lowerQuery(query);
+        StringUtils::ToLower(lowerQuery);
+        if (lowerQuery.empty()) {
+            return {};
+        }
+        const uint32_t maxEdits = MaxEdits(lowerQuery.size());
+
+        // Best score per scene; touched lists the scenes with one
+        std::vector<float> scores(m_names.size(), 0.0f);
+        std::vector<uint32_t> touched;
+        auto offer = [&](uint32_t index, float score) {
+            if (score <= 0.0f) return;
+            if (scores[index] == 0.0f) touched.push_back(index);
+            scores[index] = std::max(scores[index], score);
+        };
+        auto scoreScene = [&](uint32_t index) {
+            offer(index, std::max(FieldScore(m_names[index], lowerQuery, maxEdits) * kNameWeight,
+                                  FieldScore(m_ids[index], lowerQuery, maxEdits) * kIdWeight));
+        };
+
+        // Each edit destroys at most three of the query's trigrams, so a
+        // match within maxEdits shares all but 3 * maxEdits of them
+        std::vector<uint32_t> trigrams;
+        for (size_t pos = 0; pos + 3 <= lowerQuery.size(); ++pos) {
+            trigrams.push_back(Trigram(lowerQuery, pos));
+        }
+        std::sort(trigrams.begin(), trigrams.end());
+        trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+        const size_t lost = 3 * static_cast<size_t>(maxEdits);
+
+        if (trigrams.size() <= lost) {
+            // Nothing to narrow by: the query is too short for trigrams, or a
+            // match may share none of them (e.g. "dohgy" and "doggy"). Short
+            // queries are cheap to score against everything.
+            for (uint32_t i = 0; i < m_names.size(); ++i) {
+                scoreScene(i);
+            }
+        } else {
+            const uint32_t needed = static_cast<uint32_t>(trigrams.size() - lost);
+
+            std::vector<uint32_t> shared(m_names.size(), 0);
+            for (uint32_t trigram : trigrams) {
+                auto it = m_trigrams.find(trigram);
+                if (it == m_trigrams.end()) continue;
+                for (uint32_t index : it->second) {
+                    if (++shared[index] == needed) scoreScene(index);
+                }
+            }
+        }
+
+        for (const Term& term : m_terms) {
+            const float score = FieldScore(term.text, lowerQuery, maxEdits) * term.weight;
+            if (score > 0.0f) {
+                for (uint32_t index : term.scenes) {
+                    offer(index, score);
+                }
+            }
+        }
+
+        std::vector<Hit> hits;
+        hits.reserve(touched.size());
+        for (uint32_t index : touched) {
+            hits.push_back({ index, scores[index] });
+        }
+        auto better = [](const Hit& a, const Hit& b) {
+            return a.score != b.score ? a.score > b.score : a.index < b.index;
+        };
+        if (maxResults > 0 && maxResults < hits.size()) {
+            std::partial_sort(hits.begin(), hits.begin() + maxResults, hits.end(), better);
+            hits.resize(maxResults);
+        } else {
+            std::sort(hits.begin(), hits.end(), better);
+        }
+        return hits;
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "PCH.h"
+#include "SceneIndex.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Substring and fuzzy search over scene names and IDs.
+ *
+ * Lowercased names and IDs are stored once, along with a posting list for
+ * every three-byte sequence (trigram) that occurs in them. A query of three
+ * or more bytes is narrowed to the scenes that contain all of its trigrams,
+ * and only those are checked with a real substring search. Shorter queries
+ * scan the stored lowercase strings. Built with SceneColumns and replaced
+ * with it.
+ *
+ * FuzzySearch also matches modpacks and scene tags and tolerates typos. A
+ * scene is a name/ID candidate if it shares enough trigrams with the query to
+ * be within the allowed number of edits. Candidates and every modpack and tag
+ * are scored by their best substring edit distance to the query.
+ */
+
+namespace OStimNavigator {
+
+    struct SceneColumns;
+    struct SceneIndexes;
+
+    class SceneSearchIndex {
+    public:
+        struct Hit {
+            uint32_t index;                     // SceneColumns index
+            float score;                        // 0 .. 1, higher is better
+        };
+
+        void Build(const SceneColumns& columns, const SceneIndexes& indexes);
+
+        // Scenes whose name (or ID, with includeIds) contains query, ignoring
+        // case. An empty query matches every scene.
+        PostingList Search(std::string_view query, bool includeIds = true) const;
+
+        // Upper bound on the number of Search matches: the shortest posting
+        // list among the query's trigrams (every scene for short queries)
+        size_t EstimateMatches(std::string_view query) const;
+
+        // Scenes whose name, ID, modpack or a tag match query with at most a
+        // couple of typos, best first (ties in index order). maxResults 0
+        // returns every match.
+        std::vector<Hit> FuzzySearch(std::string_view query, size_t maxResults = 0) const;
+
+        const std::string& LowerName(uint32_t index) const { return m_names[index]; }
+        const std::string& LowerId(uint32_t index) const { return m_ids[index]; }
+
+    private:
+        // A modpack or scene tag and the scenes that carry it
+        struct Term {
+            std::string text;                   // Lowercase
+            float weight;
+            PostingList scenes;
+        };
+
+        std::vector<std::string> m_names;
+        std::vector<std::string> m_ids;
+        std::unordered_map<uint32_t, PostingList> m_trigrams;
+        std::vector<Term> m_terms;
+    };
+}
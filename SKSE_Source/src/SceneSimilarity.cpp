@@ -1,51 +1,116 @@
 #include "SceneSimilarity.h"
 #include "ActionDatabase.h"
 #include <algorithm>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace OStimNavigator {
     
-    PositionFeatures SceneSimilarity::GetPositionFeatures(const std::vector<std::string>& actorTags) {
+    namespace {
+        // Actor tags that position features are derived from, one bit each
+        enum PositionTag : uint32_t {
+            kStanding, kSuspended, kHandstanding, kSitting, kSquatting, kKneeling, kBendover,
+            kAllfours, kLyingback, kLyingfront, kLyingside, kSleeping, kDrowsy, kOnbottom,
+            kUpsidedown, kOntop, kSpreadlegs
+        };
+
+        uint32_t GetPositionTagMask(std::span<const Symbol> actorTags) {
+            static const std::unordered_map<Symbol, uint32_t> bits = [] {
+                constexpr std::pair<const char*, PositionTag> names[] = {
+                    {"standing", kStanding}, {"suspended", kSuspended}, {"handstanding", kHandstanding},
+                    {"sitting", kSitting}, {"squatting", kSquatting}, {"kneeling", kKneeling},
+                    {"bendover", kBendover}, {"allfours", kAllfours}, {"lyingback", kLyingback},
+                    {"lyingfront", kLyingfront}, {"lyingside", kLyingside}, {"sleeping", kSleeping},
+                    {"drowsy", kDrowsy}, {"onbottom", kOnbottom}, {"upsidedown", kUpsidedown},
+                    {"ontop", kOntop}, {"spreadlegs", kSpreadlegs}
+                };
+                std::unordered_map<Symbol, uint32_t> map;
+                for (const auto& [name, tag] : names) {
+                    map.emplace(Symbol::Intern(name), 1u << tag);
+                }
+                return map;
+            }();
+
+            // Compare lowercase forms, as tags may carry any case
+            uint32_t mask = 0;
+            for (Symbol tag : actorTags) {
+                auto it = bits.find(tag.Folded());
+                if (it != bits.end()) mask |= it->second;
+            }
+            return mask;
+        }
+
+        bool ById(Symbol a, Symbol b) {
+            return a.Id() < b.Id();
+        }
+
+        // Distinct action types of a scene that carry any of the category bits
+        // (every action when categories is 0), sorted by symbol id
+        void CollectActions(const SceneColumns& columns, uint32_t scene, uint8_t categories, std::vector<Symbol>& out) {
+            out.clear();
+            auto actions = columns.Actions(scene);
+            auto actionCategories = columns.ActionCategories(scene);
+            for (size_t i = 0; i < actions.size(); ++i) {
+                if (categories == 0 || (actionCategories[i] & categories) != 0) {
+                    out.push_back(actions[i].type);
+                }
+            }
+            std::sort(out.begin(), out.end(), ById);
+            out.erase(std::unique(out.begin(), out.end()), out.end());
+        }
+
+        uint8_t GetSceneCategories(const SceneColumns& columns, uint32_t scene) {
+            uint8_t categories = 0;
+            for (uint8_t actionCategories : columns.ActionCategories(scene)) {
+                categories |= actionCategories;
+            }
+            return categories;
+        }
+    }
+    
+    uint32_t SceneSimilarity::GetPositionMask(std::span<const Symbol> actorTags) {
+        return GetPositionTagMask(actorTags);
+    }
+    
+    PositionFeatures SceneSimilarity::GetPositionFeatures(const std::vector<Symbol>& actorTags) {
+        return GetPositionFeatures(GetPositionTagMask(actorTags));
+    }
+    
+    PositionFeatures SceneSimilarity::GetPositionFeatures(uint32_t mask) {
         PositionFeatures features;
         
-        // Convert all tags to lowercase for comparison
-        std::unordered_set<std::string> tags;
-        for (const auto& tag : actorTags) {
-            std::string lowerTag = tag;
-            std::transform(lowerTag.begin(), lowerTag.end(), lowerTag.begin(), ::tolower);
-            tags.insert(lowerTag);
-        }
+        auto has = [mask](PositionTag tag) { return (mask & (1u << tag)) != 0; };
         
         // Determine height level (priority: most specific first)
-        if (tags.count("standing") || tags.count("suspended") || tags.count("handstanding")) {
+        if (has(kStanding) || has(kSuspended) || has(kHandstanding)) {
             features.height = HeightLevel::High;
-        } else if (tags.count("sitting") || tags.count("squatting")) {
+        } else if (has(kSitting) || has(kSquatting)) {
             features.height = HeightLevel::MediumHigh;
-        } else if (tags.count("kneeling") || tags.count("bendover")) {
+        } else if (has(kKneeling) || has(kBendover)) {
             features.height = HeightLevel::MediumLow;
-        } else if (tags.count("allfours") || tags.count("lyingback") || tags.count("lyingfront") || 
-                   tags.count("lyingside") || tags.count("sleeping") || tags.count("drowsy") || tags.count("onbottom")) {
+        } else if (has(kAllfours) || has(kLyingback) || has(kLyingfront) || 
+                   has(kLyingside) || has(kSleeping) || has(kDrowsy) || has(kOnbottom)) {
             features.height = HeightLevel::Low;
         }
         
         // Determine orientation
-        if (tags.count("standing") || tags.count("kneeling") || tags.count("squatting") || 
-            tags.count("sitting") || tags.count("suspended")) {
+        if (has(kStanding) || has(kKneeling) || has(kSquatting) || 
+            has(kSitting) || has(kSuspended)) {
             features.orientation = Orientation::Vertical;
-        } else if (tags.count("bendover") || tags.count("handstanding") || tags.count("upsidedown")) {
+        } else if (has(kBendover) || has(kHandstanding) || has(kUpsidedown)) {
             features.orientation = Orientation::Diagonal;
-        } else if (tags.count("lyingback") || tags.count("lyingfront") || tags.count("lyingside") || 
-                   tags.count("sleeping") || tags.count("drowsy") || tags.count("allfours")) {
+        } else if (has(kLyingback) || has(kLyingfront) || has(kLyingside) || 
+                   has(kSleeping) || has(kDrowsy) || has(kAllfours)) {
             features.orientation = Orientation::Horizontal;
         }
         
         // Determine activity level
-        if (tags.count("standing") || tags.count("sitting") || tags.count("squatting") || tags.count("ontop")) {
+        if (has(kStanding) || has(kSitting) || has(kSquatting) || has(kOntop)) {
             features.activity = Activity::Active;
-        } else if (tags.count("sleeping") || tags.count("drowsy") || tags.count("onbottom") || tags.count("suspended")) {
+        } else if (has(kSleeping) || has(kDrowsy) || has(kOnbottom) || has(kSuspended)) {
             features.activity = Activity::Passive;
-        } else if (tags.count("bendover") || tags.count("allfours") || tags.count("spreadlegs") || 
-                   tags.count("kneeling") || tags.count("lyingback") || tags.count("lyingfront") || tags.count("lyingside")) {
+        } else if (has(kBendover) || has(kAllfours) || has(kSpreadlegs) || 
+                   has(kKneeling) || has(kLyingback) || has(kLyingfront) || has(kLyingside)) {
             features.activity = Activity::Neutral;
         }
         
@@ -92,121 +157,60 @@ namespace OStimNavigator {
         return (totalDimensions > 0) ? (matchingDimensions / totalDimensions) : 0.0f;
     }
     
-    float SceneSimilarity::CalculateSimilarityScore(SceneData* sceneA, SceneData* sceneB) {
-        if (!sceneA || !sceneB) return 0.0f;
+    float SceneSimilarity::CalculateSimilarityScore(const SceneColumns& columns, uint32_t sceneA, uint32_t sceneB) {
+        if (sceneA >= columns.Size() || sceneB >= columns.Size()) return 0.0f;
         
         auto& actionDB = ActionDatabase::GetSingleton();
         if (!actionDB.IsLoaded()) return 0.0f;
         
-        // Extract action types from both scenes
-        auto extractActions = [&](SceneData* scene, const std::string& categoryTag) -> std::unordered_set<std::string> {
-            std::unordered_set<std::string> actions;
-            for (const auto& action : scene->actions) {
-                // If categoryTag is specified, only include actions with that tag
-                if (!categoryTag.empty()) {
-                    if (actionDB.ActionHasTag(action.type, categoryTag)) {
-                        actions.insert(action.type);
-                    }
-                } else {
-                    actions.insert(action.type);
-                }
-            }
-            return actions;
-        };
-        
-        // Determine comparison category based on action tags
-        auto hasActionsWithTag = [&](SceneData* scene, const std::string& tag) -> bool {
-            for (const auto& action : scene->actions) {
-                if (actionDB.ActionHasTag(action.type, tag)) {
-                    return true;
-                }
-            }
-            return false;
-        };
-        
         // Priority hierarchy: sexual > sensual/romantic > all
-        std::string categoryTag;
-        bool sceneAHasSexual = hasActionsWithTag(sceneA, "sexual");
-        bool sceneBHasSexual = hasActionsWithTag(sceneB, "sexual");
-        
-        if (sceneAHasSexual || sceneBHasSexual) {
+        const uint8_t sceneCategories = GetSceneCategories(columns, sceneA) | GetSceneCategories(columns, sceneB);
+        uint8_t category = 0;
+        if (sceneCategories & SceneColumns::kSexual) {
             // Compare sexual actions
-            categoryTag = "sexual";
-        } else {
-            bool sceneAHasSensual = hasActionsWithTag(sceneA, "sensual") || hasActionsWithTag(sceneA, "romantic");
-            bool sceneBHasSensual = hasActionsWithTag(sceneB, "sensual") || hasActionsWithTag(sceneB, "romantic");
-            
-            if (sceneAHasSensual || sceneBHasSensual) {
-                // Compare sensual/romantic actions
-                categoryTag = "sensual"; // Note: we'll check both sensual and romantic below
-            } else {
-                // Compare all actions
-                categoryTag = "";
-            }
+            category = SceneColumns::kSexual;
+        } else if (sceneCategories & (SceneColumns::kSensual | SceneColumns::kRomantic)) {
+            // Compare sensual/romantic actions
+            category = SceneColumns::kSensual | SceneColumns::kRomantic;
         }
         
-        // Extract action sets based on category
-        std::unordered_set<std::string> actionsA, actionsB;
-        
-        if (categoryTag == "sexual") {
-            // Extract only sexual actions
-            actionsA = extractActions(sceneA, "sexual");
-            actionsB = extractActions(sceneB, "sexual");
-        } else if (categoryTag == "sensual") {
-            // Special case: include both sensual and romantic
-            auto sensualA = extractActions(sceneA, "sensual");
-            auto romanticA = extractActions(sceneA, "romantic");
-            actionsA.insert(sensualA.begin(), sensualA.end());
-            actionsA.insert(romanticA.begin(), romanticA.end());
-            
-            auto sensualB = extractActions(sceneB, "sensual");
-            auto romanticB = extractActions(sceneB, "romantic");
-            actionsB.insert(sensualB.begin(), sensualB.end());
-            actionsB.insert(romanticB.begin(), romanticB.end());
-        } else {
-            // Empty categoryTag: compare all actions
-            actionsA = extractActions(sceneA, "");
-            actionsB = extractActions(sceneB, "");
-        }
-        
-        // If both scenes have no actions in this category, return 0
-        if (actionsA.empty() && actionsB.empty()) {
-            return 0.0f;
-        }
+        // Extract action sets based on category (0 compares all actions)
+        thread_local std::vector<Symbol> actionsA, actionsB;
+        CollectActions(columns, sceneA, category, actionsA);
+        CollectActions(columns, sceneB, category, actionsB);
         
-        // If one scene has actions and the other doesn't, return 0
+        // If either scene has no actions in this category, return 0
         if (actionsA.empty() || actionsB.empty()) {
             return 0.0f;
         }
         
-        // Calculate Jaccard similarity: |A ∩ B| / |A ∪ B|
-        std::unordered_set<std::string> intersection;
-        std::unordered_set<std::string> unionSet;
-        
-        // Calculate intersection
-        for (const auto& action : actionsA) {
-            if (actionsB.find(action) != actionsB.end()) {
-                intersection.insert(action);
+        // Calculate Jaccard similarity: |A ∩ B| / |A ∪ B| over the sorted sets
+        size_t intersection = 0;
+        for (auto itA = actionsA.begin(), itB = actionsB.begin(); itA != actionsA.end() && itB != actionsB.end();) {
+            if (ById(*itA, *itB)) {
+                ++itA;
+            } else if (ById(*itB, *itA)) {
+                ++itB;
+            } else {
+                ++intersection; ++itA; ++itB;
             }
         }
+        const size_t unionSize = actionsA.size() + actionsB.size() - intersection;
         
-        // Calculate union
-        unionSet.insert(actionsA.begin(), actionsA.end());
-        unionSet.insert(actionsB.begin(), actionsB.end());
-        
-        if (unionSet.empty()) return 0.0f;
-        
-        float actionSimilarity = static_cast<float>(intersection.size()) / static_cast<float>(unionSet.size());
+        float actionSimilarity = static_cast<float>(intersection) / static_cast<float>(unionSize);
         
         // Calculate position similarity for each actor
         float positionSimilarity = 0.0f;
-        int actorCount = std::min(static_cast<int>(sceneA->actors.size()), static_cast<int>(sceneB->actors.size()));
+        const uint32_t actorsA = columns.actorOffsets[sceneA];
+        const uint32_t actorsB = columns.actorOffsets[sceneB];
+        int actorCount = static_cast<int>(std::min(columns.actorOffsets[sceneA + 1] - actorsA,
+                                                   columns.actorOffsets[sceneB + 1] - actorsB));
         
         if (actorCount > 0) {
             float totalPositionSimilarity = 0.0f;
             for (int i = 0; i < actorCount; ++i) {
-                PositionFeatures featuresA = GetPositionFeatures(sceneA->actors[i].tags);
-                PositionFeatures featuresB = GetPositionFeatures(sceneB->actors[i].tags);
+                PositionFeatures featuresA = GetPositionFeatures(columns.actorPositions[actorsA + i]);
+                PositionFeatures featuresB = GetPositionFeatures(columns.actorPositions[actorsB + i]);
                 totalPositionSimilarity += CalculatePositionSimilarity(featuresA, featuresB);
             }
             positionSimilarity = totalPositionSimilarity / actorCount;
@@ -2,6 +2,7 @@
 
 #include "PCH.h"
 #include "SceneDatabase.h"
+#include <span>
 #include <vector>
 #include <string>
 
@@ -21,12 +22,19 @@ namespace OStimNavigator {
     class SceneSimilarity {
     public:
         // Extract position features from actor tags
-        static PositionFeatures GetPositionFeatures(const std::vector<std::string>& actorTags);
+        static PositionFeatures GetPositionFeatures(const std::vector<Symbol>& actorTags);
+        
+        // Bit mask of the position tags among actorTags (stored per actor in SceneColumns)
+        static uint32_t GetPositionMask(std::span<const Symbol> actorTags);
+        
+        // Extract position features from a mask returned by GetPositionMask
+        static PositionFeatures GetPositionFeatures(uint32_t positionMask);
         
         // Calculate similarity between two position feature sets (0.0 to 1.0)
         static float CalculatePositionSimilarity(const PositionFeatures& featuresA, const PositionFeatures& featuresB);
         
-        // Calculate overall similarity score between two scenes (0.0 to 1.0)
-        static float CalculateSimilarityScore(SceneData* sceneA, SceneData* sceneB);
+        // Calculate overall similarity score between two scenes (0.0 to 1.0),
+        // given as SceneColumns indices
+        static float CalculateSimilarityScore(const SceneColumns& columns, uint32_t sceneA, uint32_t sceneB);
     };
 }
@@ -0,0 +1,183 @@
+#include "SceneTagWriter.h"
+#include "JsonUtils.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_set>
+
+namespace OStimNavigator {
+    namespace SceneTagWriter {
+
+        namespace {
+            struct State {
+                std::mutex mutex;
+                std::condition_variable cv;
+                std::map<std::filesystem::path, std::vector<std::string>> pending;
+                std::set<std::filesystem::path> inFlight;
+                bool started = false;
+            };
+
+            // Never destroyed: the detached writer may still be waiting on it
+            // while the DLL's statics are torn down at exit.
+            State& GetState() {
+                static State* state = new State;
+                return *state;
+            }
+
+            // nlohmann dumps with "\n"; copy whole lines instead of single characters.
+            std::string ToCRLF(const std::string& text) {
+                std::string out;
+                out.reserve(text.size() + std::count(text.begin(), text.end(), '\n'));
+                size_t begin = 0;
+                for (size_t nl = text.find('\n'); nl != std::string::npos; nl = text.find('\n', begin)) {
+                    out.append(text, begin, nl - begin);
+                    out += "\r\n";
+                    begin = nl + 1;
+                }
+                out.append(text, begin, std::string::npos);
+                return out;
+            }
+
+            // Returns true if the file was rewritten.
+            bool WriteTags(const std::filesystem::path& path, const std::vector<std::string>& tags) {
+                // The write-back is the only place that needs the full document:
+                // it has to preserve every other field verbatim.
+                try {
+                    std::string raw;
+                    if (!JsonUtils::ReadFile(path, raw)) {
+                        SKSE::log::warn("SceneTagWriter: could not open {}", path.string());
+                        return false;
+                    }
+                    // Detect whether the file uses CRLF so we can restore it on write-back.
+                    const bool hasCRLF = raw.find("\r\n") != std::string::npos;
+
+                    nlohmann::ordered_json j = nlohmann::ordered_json::parse(raw);
+                    auto& jsonTags = j["tags"];
+                    std::unordered_set<std::string> existing;
+                    if (jsonTags.is_array()) {
+                        for (const auto& t : jsonTags) {
+                            if (t.is_string()) existing.insert(t.get<std::string>());
+                        }
+                    }
+
+                    size_t added = 0;
+                    for (const auto& tag : tags) {
+                        if (existing.insert(tag).second) {
+                            jsonTags.push_back(tag);
+                            ++added;
+                        }
+                    }
+                    if (added == 0) {
+                        return false;
+                    }
+
+                    std::string dumped = j.dump(4);
+                    if (hasCRLF) {
+                        dumped = ToCRLF(dumped);
+                    }
+
+                    // Write beside the file and swap it in, so a write cut short leaves
+                    // the original intact (its tags are queued again next load).
+                    std::filesystem::path temp = path;
+                    temp += ".tmp";
+                    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+                    if (!out.is_open()) {
+                        SKSE::log::warn("SceneTagWriter: could not open {} for writing", temp.string());
+                        return false;
+                    }
+                    out.write(dumped.data(), static_cast<std::streamsize>(dumped.size()));
+                    out.close();
+                    if (!out) {
+                        SKSE::log::warn("SceneTagWriter: could not write {}", temp.string());
+                        std::error_code ec;
+                        std::filesystem::remove(temp, ec);
+                        return false;
+                    }
+                    std::filesystem::rename(temp, path);
+                    SKSE::log::info("SceneTagWriter: injected {} metadata tag(s) into {}", added, path.string());
+                    return true;
+                } catch (const std::exception& e) {
+                    SKSE::log::warn("SceneTagWriter: failed to save {}: {}", path.string(), e.what());
+                    return false;
+                }
+            }
+
+            // Writes queued files in batches for the rest of the session.
+            void RunWriter(State& state) {
+                std::unique_lock lock(state.mutex);
+                while (true) {
+                    state.cv.wait(lock, [&state]() { return !state.pending.empty(); });
+
+                    auto t0 = std::chrono::steady_clock::now();
+                    size_t written = 0;
+                    while (!state.pending.empty()) {
+                        auto job = state.pending.extract(state.pending.begin());
+                        state.inFlight.insert(job.key());
+                        lock.unlock();
+                        if (WriteTags(job.key(), job.mapped())) {
+                            ++written;
+                        }
+                        lock.lock();
+                        state.inFlight.erase(job.key());
+                        state.cv.notify_all();
+                    }
+                    lock.unlock();
+
+                    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - t0).count();
+                    SKSE::log::info("SceneTagWriter: updated {} scene file(s) in {} ms", written, ms);
+                    lock.lock();
+                }
+            }
+        }
+
+        void Enqueue(const std::filesystem::path& path, const std::vector<std::string>& tags) {
+            auto& state = GetState();
+            std::lock_guard lock(state.mutex);
+            auto& queued = state.pending[path];
+            for (const auto& tag : tags) {
+                if (std::find(queued.begin(), queued.end(), tag) == queued.end()) {
+                    queued.push_back(tag);
+                }
+            }
+            state.cv.notify_all();
+        }
+
+        void Start() {
+            auto& state = GetState();
+            std::lock_guard lock(state.mutex);
+            if (state.started) {
+                return;
+            }
+            state.started = true;
+            if (!state.pending.empty()) {
+                SKSE::log::info("SceneTagWriter: writing metadata tags into {} scene file(s) in the background",
+                    state.pending.size());
+            }
+            std::thread(RunWriter, std::ref(state)).detach();
+        }
+
+        void Flush(const std::filesystem::path& path) {
+            auto& state = GetState();
+            std::unique_lock lock(state.mutex);
+            state.cv.wait(lock, [&state, &path]() { return !state.inFlight.count(path); });
+
+            auto job = state.pending.extract(path);
+            if (job.empty()) {
+                return;
+            }
+            state.inFlight.insert(path);
+            lock.unlock();
+            WriteTags(job.key(), job.mapped());
+            lock.lock();
+            state.inFlight.erase(path);
+            state.cv.notify_all();
+        }
+    }
+}
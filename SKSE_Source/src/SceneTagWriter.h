@@ -0,0 +1,39 @@
+#pragma once
+
+#include "PCH.h"
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/*
+ * Deferred write-back of OStimNet metadata tags into scene files.
+ *
+ * Scene parsing only records which tags a file is missing; the scene itself
+ * already carries them in memory. The files are rewritten later on one
+ * background thread, once per file no matter how many times it was queued, so
+ * a fresh metadata file no longer turns startup into hundreds of synchronous
+ * writes. Writing only starts after Start(), which CatalogLoader calls when the
+ * catalog is ready.
+ *
+ * The writer is never stopped or waited for; the game can exit in the middle
+ * of a write. Each file is written to a temporary beside it and renamed into
+ * place, so that never leaves a truncated scene, and tags that did not make it
+ * to disk are kept in the scene snapshot and queued again on the next load.
+ */
+
+namespace OStimNavigator {
+    namespace SceneTagWriter {
+
+        // Queue tags to append to the file's "tags" array. Thread-safe. Tags the
+        // file already has when it is written are skipped.
+        void Enqueue(const std::filesystem::path& path, const std::vector<std::string>& tags);
+
+        // Allow the background writer to run (now and for anything queued later).
+        void Start();
+
+        // Write any pending tags for this file on the calling thread and wait for
+        // an in-flight write of it to finish. Call before reading or replacing a
+        // scene file outside the loader, so a queued write cannot clobber it.
+        void Flush(const std::filesystem::path& path);
+    }
+}
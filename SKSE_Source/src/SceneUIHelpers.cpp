@@ -92,7 +92,7 @@ namespace OStimNavigator {
                 // Collect and sort actors by gender (males first, then females, then others)
                 std::vector<std::string> genderList;
                 for (const auto& actor : actors) {
-                    std::string intendedSex = actor.intendedSex;
+                    std::string intendedSex = actor.intendedSex.str();
                     StringUtils::ToLower(intendedSex);
                     genderList.push_back(intendedSex);
                 }
@@ -173,7 +173,7 @@ namespace OStimNavigator {
                 RenderPillCollection(
                     actions,
                     highlightSet,
-                    [](const SceneActionData& action) -> const std::string& { return action.type; },
+                    [](const SceneActionData& action) -> const std::string& { return action.type.str(); },
                     filterSet,
                     [threadID](const SceneActionData& action) {
                         // Custom tooltip for action details
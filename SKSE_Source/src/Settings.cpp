@@ -16,10 +16,37 @@ void Settings::Load() {
     char levelBuf[32] = {};
     GetPrivateProfileStringA("Debug", "LogLevel", "info", levelBuf, sizeof(levelBuf), path.c_str());
     logLevel = levelBuf;
+    explainFilterPlans = GetPrivateProfileIntA("Debug", "ExplainFilterPlans", 0, path.c_str()) != 0;
+    benchmarkSceneFilter = GetPrivateProfileIntA("Debug", "BenchmarkSceneFilter", 0, path.c_str()) != 0;
+
+    parallelSceneLoad = GetPrivateProfileIntA("Performance", "ParallelSceneLoad", 1, path.c_str()) != 0;
+    parallelStartup = GetPrivateProfileIntA("Performance", "ParallelStartup", 1, path.c_str()) != 0;
+    asyncCatalogLoad = GetPrivateProfileIntA("Performance", "AsyncCatalogLoad", 1, path.c_str()) != 0;
+    sceneLoadThreads = static_cast<uint32_t>(
+        GetPrivateProfileIntA("Performance", "SceneLoadThreads", 0, path.c_str()));
+    parallelSceneFilter = GetPrivateProfileIntA("Performance", "ParallelSceneFilter", 1, path.c_str()) != 0;
+    sceneFilterThreads = static_cast<uint32_t>(
+        GetPrivateProfileIntA("Performance", "SceneFilterThreads", 0, path.c_str()));
+    sceneCache = GetPrivateProfileIntA("Performance", "SceneCache", 1, path.c_str()) != 0;
+    sceneCacheContentHash = GetPrivateProfileIntA("Performance", "SceneCacheContentHash", 1, path.c_str()) != 0;
+    sceneBundle = GetPrivateProfileIntA("Performance", "SceneBundle", 1, path.c_str()) != 0;
+    writeInjectedTags = GetPrivateProfileIntA("Performance", "WriteInjectedTags", 1, path.c_str()) != 0;
 
     SKSE::log::info("Settings loaded from {}", path);
     SKSE::log::info("  ToggleNavigator key = 0x{:02X} ({})", toggleNavigatorKey, toggleNavigatorKey);
     SKSE::log::info("  LogLevel            = {}", logLevel);
+    SKSE::log::info("  ExplainFilterPlans  = {}", explainFilterPlans);
+    SKSE::log::info("  BenchmarkSceneFilter = {}", benchmarkSceneFilter);
+    SKSE::log::info("  ParallelSceneLoad   = {}", parallelSceneLoad);
+    SKSE::log::info("  ParallelStartup     = {}", parallelStartup);
+    SKSE::log::info("  AsyncCatalogLoad    = {}", asyncCatalogLoad);
+    SKSE::log::info("  SceneLoadThreads    = {}", sceneLoadThreads);
+    SKSE::log::info("  ParallelSceneFilter = {}", parallelSceneFilter);
+    SKSE::log::info("  SceneFilterThreads  = {}", sceneFilterThreads);
+    SKSE::log::info("  SceneCache          = {}", sceneCache);
+    SKSE::log::info("  SceneCacheContentHash = {}", sceneCacheContentHash);
+    SKSE::log::info("  SceneBundle         = {}", sceneBundle);
+    SKSE::log::info("  WriteInjectedTags   = {}", writeInjectedTags);
 }
 
 void Settings::ApplyLogLevel() const {
@@ -26,6 +26,65 @@ public:
     // Default: info
     std::string logLevel = "info";
 
+    // Log the query plan of every scene filter run, with the number of scenes
+    // left after each stage.
+    // Default: false
+    bool explainFilterPlans = false;
+
+    // Time the first scene filter run of the session on 1, 2, 4 ... threads up
+    // to one per hardware thread, and log the scaling.
+    // Default: false
+    bool benchmarkSceneFilter = false;
+
+    // Parse scene files on a pool of worker threads at startup.
+    // The merged result is identical to a serial load.
+    // Default: true
+    bool parallelSceneLoad = true;
+
+    // Run the independent database loaders at kDataLoaded concurrently.
+    // Default: true
+    bool parallelStartup = true;
+
+    // Build the scene catalog in the background instead of blocking kDataLoaded.
+    // Default: true
+    bool asyncCatalogLoad = true;
+
+    // Number of scene parse workers. 0 = one per hardware thread.
+    // Default: 0
+    uint32_t sceneLoadThreads = 0;
+
+    // Filter and score large scene lists on a pool of worker threads. The
+    // result is identical to a serial run.
+    // Default: true
+    bool parallelSceneFilter = true;
+
+    // Number of threads a scene filter run may use. 0 = one per hardware thread.
+    // Default: 0
+    uint32_t sceneFilterThreads = 0;
+
+    // Keep a binary snapshot of the parsed scene catalog. Unchanged scene files
+    // are taken from it; new or modified ones are parsed again. A change to
+    // any action or OStimNet metadata file invalidates the whole snapshot.
+    // Default: true
+    bool sceneCache = true;
+
+    // When a scene file's mtime changed but its size did not, compare a content
+    // hash before re-parsing it (mod manager redeploys touch every file).
+    // Default: true
+    bool sceneCacheContentHash = true;
+
+    // Keep the raw scene files packed in one bundle file. Scene files whose
+    // stamp matches the bundle are read from it instead of being opened one
+    // by one, which is what costs the most under a virtual filesystem.
+    // Default: true
+    bool sceneBundle = true;
+
+    // Write OStimNet metadata tags (intent, positions) back into the scene
+    // files, in the background once the catalog is ready. When false the tags
+    // only exist in memory and mod files are never modified.
+    // Default: true
+    bool writeInjectedTags = true;
+
 private:
     Settings() = default;
     Settings(const Settings&) = delete;
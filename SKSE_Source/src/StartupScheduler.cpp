@@ -0,0 +1,228 @@
+#include "StartupScheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace OStimNavigator {
+
+    // Shared by the caller, the workers and any queued game-thread tasks, so an
+    // asynchronous run keeps it alive until the last task has finished.
+    struct StartupScheduler::Graph {
+        struct Task {
+            std::string name;
+            std::function<void()> fn;
+            Affinity affinity = Affinity::Worker;
+            std::vector<size_t> dependents;
+            size_t pendingDependencies = 0;
+            long long ms = 0;
+        };
+
+        std::vector<Task> tasks;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<size_t> workerReady;
+        std::deque<size_t> gameReady;
+        size_t finished = 0;
+        size_t failed = 0;
+        bool postGameTasks = false;     // Queue game-thread tasks through SKSE instead of gameReady
+
+        std::chrono::steady_clock::time_point started;
+        size_t threadCount = 0;
+
+        bool Done() const { return finished == tasks.size(); }
+
+        // Caller holds the lock.
+        void Enqueue(const std::shared_ptr<Graph>& self, size_t index) {
+            if (tasks[index].affinity == Affinity::Worker) {
+                workerReady.push_back(index);
+            } else if (postGameTasks) {
+                SKSE::GetTaskInterface()->AddTask([self, index]() {
+                    std::unique_lock lock(self->mutex);
+                    self->RunTask(self, lock, index);
+                });
+            } else {
+                gameReady.push_back(index);
+            }
+        }
+
+        void EnqueueRoots(const std::shared_ptr<Graph>& self) {
+            for (size_t i = 0; i < tasks.size(); ++i) {
+                if (tasks[i].pendingDependencies == 0) {
+                    Enqueue(self, i);
+                }
+            }
+        }
+
+        bool Execute(Task& task) {
+            bool ok = true;
+            auto t0 = std::chrono::steady_clock::now();
+            try {
+                task.fn();
+            } catch (const std::exception& e) {
+                SKSE::log::error("StartupScheduler: '{}' failed: {}", task.name, e.what());
+                ok = false;
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            task.ms = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
+            return ok;
+        }
+
+        // Runs one task outside the lock, then releases its dependents.
+        void RunTask(const std::shared_ptr<Graph>& self, std::unique_lock<std::mutex>& lock, size_t index) {
+            lock.unlock();
+            bool ok = Execute(tasks[index]);
+            lock.lock();
+            if (!ok) {
+                ++failed;
+            }
+            for (size_t dependent : tasks[index].dependents) {
+                if (--tasks[dependent].pendingDependencies == 0) {
+                    Enqueue(self, dependent);
+                }
+            }
+            ++finished;
+            cv.notify_all();
+        }
+
+        void WorkerLoop(const std::shared_ptr<Graph>& self) {
+            std::unique_lock lock(mutex);
+            while (true) {
+                cv.wait(lock, [this]() { return !workerReady.empty() || Done(); });
+                if (workerReady.empty()) {
+                    return;
+                }
+                size_t index = workerReady.front();
+                workerReady.pop_front();
+                RunTask(self, lock, index);
+            }
+        }
+
+        bool Report() const {
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - started).count();
+            for (const auto& task : tasks) {
+                SKSE::log::info("  startup task '{}': {} ms", task.name, task.ms);
+            }
+            SKSE::log::info("Startup: {} loader(s) finished in {} ms on {} worker thread(s) + game thread",
+                tasks.size(), ms, threadCount);
+            return failed == 0;
+        }
+    };
+
+    StartupScheduler::StartupScheduler() : m_graph(std::make_shared<Graph>()) {}
+
+    void StartupScheduler::Add(std::string name, std::vector<std::string> dependencies,
+                               std::function<void()> task, Affinity affinity) {
+        auto& tasks = m_graph->tasks;
+        const size_t index = tasks.size();
+        auto& entry = tasks.emplace_back();
+        entry.name = std::move(name);
+        entry.fn = std::move(task);
+        entry.affinity = affinity;
+
+        for (const auto& dependency : dependencies) {
+            auto it = std::find_if(tasks.begin(), tasks.begin() + index,
+                [&dependency](const Graph::Task& t) { return t.name == dependency; });
+            if (it == tasks.begin() + index) {
+                SKSE::log::error("StartupScheduler: '{}' depends on unknown task '{}' — ignoring", entry.name, dependency);
+                continue;
+            }
+            it->dependents.push_back(index);
+            ++entry.pendingDependencies;
+        }
+    }
+
+    bool StartupScheduler::Run(bool parallel) {
+        auto graph = m_graph;
+        graph->started = std::chrono::steady_clock::now();
+
+        size_t workerTaskCount = std::count_if(graph->tasks.begin(), graph->tasks.end(),
+            [](const Graph::Task& t) { return t.affinity == Affinity::Worker; });
+        graph->threadCount = parallel
+            ? std::min<size_t>(workerTaskCount, std::max(1u, std::thread::hardware_concurrency()))
+            : 0;
+
+        if (graph->threadCount == 0) {
+            for (auto& task : graph->tasks) {
+                if (!graph->Execute(task)) {
+                    ++graph->failed;
+                }
+            }
+            return graph->Report();
+        }
+
+        std::vector<std::thread> workers;
+        {
+            std::unique_lock lock(graph->mutex);
+            graph->EnqueueRoots(graph);
+        }
+        workers.reserve(graph->threadCount);
+        for (size_t i = 0; i < graph->threadCount; ++i) {
+            workers.emplace_back([graph]() { graph->WorkerLoop(graph); });
+        }
+
+        // The calling (game) thread services game-thread tasks until everything is done.
+        {
+            std::unique_lock lock(graph->mutex);
+            while (true) {
+                graph->cv.wait(lock, [&graph]() { return !graph->gameReady.empty() || graph->Done(); });
+                if (graph->gameReady.empty()) {
+                    break;
+                }
+                size_t index = graph->gameReady.front();
+                graph->gameReady.pop_front();
+                graph->RunTask(graph, lock, index);
+            }
+        }
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        return graph->Report();
+    }
+
+    void StartupScheduler::RunAsync(bool parallel, std::function<void(bool)> onFinished) {
+        auto graph = m_graph;
+        graph->started = std::chrono::steady_clock::now();
+        graph->postGameTasks = true;
+
+        // Serial mode still needs one worker so the caller is never blocked.
+        size_t workerTaskCount = std::count_if(graph->tasks.begin(), graph->tasks.end(),
+            [](const Graph::Task& t) { return t.affinity == Affinity::Worker; });
+        graph->threadCount = parallel
+            ? std::min<size_t>(workerTaskCount, std::max(1u, std::thread::hardware_concurrency()))
+            : 1;
+        graph->threadCount = std::max<size_t>(graph->threadCount, 1);
+
+        {
+            std::unique_lock lock(graph->mutex);
+            graph->EnqueueRoots(graph);
+        }
+
+        std::thread([graph, onFinished = std::move(onFinished)]() {
+            std::vector<std::thread> workers;
+            workers.reserve(graph->threadCount - 1);
+            for (size_t i = 1; i < graph->threadCount; ++i) {
+                workers.emplace_back([graph]() { graph->WorkerLoop(graph); });
+            }
+            graph->WorkerLoop(graph);
+
+            // This worker only leaves its loop once every task, including the
+            // game-thread ones, has finished.
+            for (auto& worker : workers) {
+                worker.join();
+            }
+
+            bool ok = graph->Report();
+            SKSE::GetTaskInterface()->AddTask([onFinished, ok]() {
+                if (onFinished) {
+                    onFinished(ok);
+                }
+            });
+        }).detach();
+    }
+}
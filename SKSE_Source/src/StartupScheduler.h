@@ -0,0 +1,44 @@
+#pragma once
+
+#include "PCH.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace OStimNavigator {
+
+    // Runs the kDataLoaded loaders as a dependency graph. Tasks whose inputs are
+    // ready run concurrently on worker threads; tasks that touch game forms
+    // (TESDataHandler lookups) are marshalled back to the game thread. The
+    // per-task and total time is logged when the graph has finished.
+    class StartupScheduler {
+    public:
+        enum class Affinity {
+            Worker,         // Any thread; pure file/JSON work
+            GameThread      // Only on the game thread
+        };
+
+        StartupScheduler();
+
+        // Register a task. Dependencies name tasks that were added earlier.
+        void Add(std::string name, std::vector<std::string> dependencies,
+                 std::function<void()> task, Affinity affinity = Affinity::Worker);
+
+        // Execute all tasks and block until they finish. Must be called on the
+        // game thread, which runs the game-thread tasks itself. With parallel =
+        // false they run one after another in the order they were added (which
+        // is always a valid order). Returns false if any task threw.
+        bool Run(bool parallel);
+
+        // Execute all tasks on background threads and return immediately.
+        // Game-thread tasks are queued through SKSE's task interface, and
+        // onFinished is called on the game thread with Run()'s result.
+        void RunAsync(bool parallel, std::function<void(bool)> onFinished);
+
+    private:
+        struct Graph;
+
+        std::shared_ptr<Graph> m_graph;
+    };
+}
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <algorithm>
+#include <cstdint>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace OStimNavigator {
@@ -20,6 +23,45 @@ namespace OStimNavigator {
             return result;
         }
         
+        // ASCII lowercase of one character, matching ToLower in the "C" locale
+        inline char FoldCase(char c) {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+
+        inline bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+            if (a.size() != b.size()) return false;
+            for (size_t i = 0; i < a.size(); ++i) {
+                if (FoldCase(a[i]) != FoldCase(b[i])) return false;
+            }
+            return true;
+        }
+
+        // 64-bit FNV-1a over the lowercase characters, so strings that differ
+        // only in case hash alike
+        inline uint64_t FoldedHash(std::string_view text) {
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for (char c : text) {
+                hash = (hash ^ static_cast<uint8_t>(FoldCase(c))) * 0x100000001b3ull;
+            }
+            return hash;
+        }
+
+        // Case-insensitive hash and equality for string-keyed containers. Both are
+        // transparent, so find() takes a string_view or C string without building
+        // (or lowercasing) a std::string key.
+        struct CaseInsensitiveHash {
+            using is_transparent = void;
+            size_t operator()(std::string_view text) const noexcept { return static_cast<size_t>(FoldedHash(text)); }
+        };
+
+        struct CaseInsensitiveEqual {
+            using is_transparent = void;
+            bool operator()(std::string_view a, std::string_view b) const noexcept { return EqualsIgnoreCase(a, b); }
+        };
+
+        template<typename T>
+        using CaseInsensitiveMap = std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqual>;
+
         // Convert unordered_set to sorted vector
         template<typename T>
         std::vector<T> SetToSortedVector(const std::unordered_set<T>& inputSet) {
@@ -0,0 +1,180 @@
+#include "SymbolTable.h"
+#include "StringUtils.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <mutex>
+
+namespace OStimNavigator {
+
+    SymbolTable::SymbolTable() {
+        // Id 0 is the empty string, so a default-constructed Symbol is valid.
+        std::unique_lock lock(m_mutex);
+        InternLocked({});
+    }
+
+    SymbolTable::~SymbolTable() {
+        for (auto& chunk : m_chunks) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    Symbol SymbolTable::Intern(std::string_view text) {
+        {
+            std::shared_lock lock(m_mutex);
+            auto it = m_index.find(text);
+            if (it != m_index.end()) {
+                return Symbol(it->second);
+            }
+        }
+        std::unique_lock lock(m_mutex);
+        return InternLocked(text);
+    }
+
+    Symbol SymbolTable::InternLocked(std::string_view text) {
+        auto it = m_index.find(text);
+        if (it != m_index.end()) {
+            return Symbol(it->second);
+        }
+
+        // Intern the lowercase form first so every entry's folded symbol exists.
+        Symbol folded;
+        if (std::any_of(text.begin(), text.end(), [](char c) { return c >= 'A' && c <= 'Z'; })) {
+            folded = InternLocked(StringUtils::ToLowerCopy(std::string(text)));
+        }
+
+        const uint32_t id = m_size.load(std::memory_order_relaxed);
+        const uint32_t chunkIndex = id >> kChunkBits;
+        if (chunkIndex >= kMaxChunks) {
+            throw std::length_error("SymbolTable: too many distinct strings");
+        }
+        Entry* chunk = m_chunks[chunkIndex].load(std::memory_order_relaxed);
+        if (!chunk) {
+            chunk = new Entry[kChunkSize];
+            m_chunks[chunkIndex].store(chunk, std::memory_order_release);
+        }
+
+        Entry& entry = chunk[id & (kChunkSize - 1)];
+        entry.text.assign(text);
+        entry.folded = folded.empty() ? Symbol(id) : folded;
+        m_index.emplace(entry.text, id);
+        m_size.store(id + 1, std::memory_order_release);
+        return Symbol(id);
+    }
+
+    std::optional<Symbol> SymbolTable::Find(std::string_view text) const {
+        std::shared_lock lock(m_mutex);
+        auto it = m_index.find(text);
+        if (it == m_index.end()) {
+            return std::nullopt;
+        }
+        return Symbol(it->second);
+    }
+
+    std::optional<Symbol> SymbolTable::FromId(uint32_t id) const {
+        if (id >= Size()) {
+            return std::nullopt;
+        }
+        return Symbol(id);
+    }
+
+    void to_json(nlohmann::json& j, const Symbol& symbol) {
+        j = symbol.str();
+    }
+
+    std::vector<std::string> ToSortedStrings(const std::unordered_set<Symbol>& symbols) {
+        std::vector<std::string> result;
+        result.reserve(symbols.size());
+        for (Symbol symbol : symbols) {
+            result.push_back(symbol.str());
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    std::vector<Symbol> InternAll(const std::unordered_set<std::string>& strings) {
+        std::vector<Symbol> result;
+        result.reserve(strings.size());
+        for (const auto& text : strings) {
+            result.push_back(Symbol::Intern(text));
+        }
+        return result;
+    }
+
+    // ── SymbolListTable ──────────────────────────────────────────────────────
+
+    SymbolListTable::SymbolListTable() {
+        // Id 0 is the empty list, so a default-constructed SymbolList is valid.
+        m_chunks[0].store(new Entry[kChunkSize], std::memory_order_release);
+        m_size = 1;
+    }
+
+    SymbolListTable::~SymbolListTable() {
+        for (auto& chunk : m_chunks) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    size_t SymbolListTable::ListHash::operator()(std::span<const Symbol> symbols) const noexcept {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (Symbol symbol : symbols) {
+            hash = (hash ^ symbol.Id()) * 0x100000001b3ull;
+        }
+        return static_cast<size_t>(hash);
+    }
+
+    SymbolList SymbolListTable::Intern(std::span<const Symbol> symbols) {
+        if (symbols.empty()) {
+            return {};
+        }
+        {
+            std::shared_lock lock(m_mutex);
+            auto it = m_index.find(symbols);
+            if (it != m_index.end()) {
+                return SymbolList(it->second);
+            }
+        }
+
+        std::unique_lock lock(m_mutex);
+        auto it = m_index.find(symbols);
+        if (it != m_index.end()) {
+            return SymbolList(it->second);
+        }
+
+        const uint32_t id = m_size;
+        const uint32_t chunkIndex = id >> kChunkBits;
+        if (chunkIndex >= kMaxChunks) {
+            throw std::length_error("SymbolListTable: too many distinct lists");
+        }
+        Entry* chunk = m_chunks[chunkIndex].load(std::memory_order_relaxed);
+        if (!chunk) {
+            chunk = new Entry[kChunkSize];
+            m_chunks[chunkIndex].store(chunk, std::memory_order_release);
+        }
+
+        // Blocks never move; a list longer than a block gets one of its own
+        if (symbols.size() > m_blockFree) {
+            const size_t blockSize = std::max(kBlockSize, symbols.size());
+            m_blocks.push_back(std::make_unique<Symbol[]>(blockSize));
+            m_blockCursor = m_blocks.back().get();
+            m_blockFree = blockSize;
+        }
+        Symbol* data = m_blockCursor;
+        std::copy(symbols.begin(), symbols.end(), data);
+        m_blockCursor += symbols.size();
+        m_blockFree -= symbols.size();
+
+        Entry& entry = chunk[id & (kChunkSize - 1)];
+        entry.data = data;
+        entry.size = static_cast<uint32_t>(symbols.size());
+        m_index.emplace(std::span<const Symbol>(data, symbols.size()), id);
+        m_size = id + 1;
+        return SymbolList(id);
+    }
+
+    void to_json(nlohmann::json& j, const SymbolList& list) {
+        j = nlohmann::json::array();
+        for (Symbol symbol : list) {
+            j.push_back(symbol.str());
+        }
+    }
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "PCH.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <nlohmann/json_fwd.hpp>
+
+/*
+ * Interned strings for the catalog.
+ *
+ * The same few hundred tags, action types, modpack and furniture IDs repeat
+ * across thousands of scenes. Scenes hold a 4-byte Symbol per value instead of
+ * a std::string, so equality is an integer compare and each distinct string is
+ * stored once. Symbols are resolved back to text only at display and API
+ * boundaries. Entries are never removed, so a resolved string stays valid for
+ * the lifetime of the plugin.
+ *
+ * SymbolList does the same for short lists such as an actor's tags: each
+ * distinct list is stored once in a shared pool and referenced by a 4-byte id.
+ */
+
+namespace OStimNavigator {
+
+    class Symbol {
+    public:
+        constexpr Symbol() = default;       // The empty string
+
+        // Thread-safe. Returns the existing symbol if the text was interned before.
+        static Symbol Intern(std::string_view text);
+
+        // The symbol for text if it has been interned, without adding it.
+        static std::optional<Symbol> Find(std::string_view text);
+
+        const std::string& str() const;
+        std::string_view view() const { return str(); }
+        const char* c_str() const { return str().c_str(); }
+        bool empty() const { return m_id == 0; }
+
+        // The lowercase form of this symbol (itself if it has no uppercase letters)
+        Symbol Folded() const;
+
+        uint32_t Id() const { return m_id; }
+
+        friend bool operator==(Symbol, Symbol) = default;
+
+    private:
+        friend class SymbolTable;
+        explicit constexpr Symbol(uint32_t id) : m_id(id) {}
+
+        uint32_t m_id = 0;
+    };
+}
+
+template <>
+struct std::hash<OStimNavigator::Symbol> {
+    size_t operator()(OStimNavigator::Symbol symbol) const noexcept {
+        return std::hash<uint32_t>{}(symbol.Id());
+    }
+};
+
+namespace OStimNavigator {
+
+    class SymbolTable {
+    public:
+        static SymbolTable& GetSingleton() {
+            static SymbolTable instance;
+            return instance;
+        }
+
+        Symbol Intern(std::string_view text);
+        std::optional<Symbol> Find(std::string_view text) const;
+
+        // Lock-free: the id was handed out by Intern, so its entry is already written.
+        const std::string& Resolve(Symbol symbol) const { return GetEntry(symbol.m_id).text; }
+        Symbol Folded(Symbol symbol) const { return GetEntry(symbol.m_id).folded; }
+
+        // Symbols handed out so far; ids are 0 .. Size() - 1.
+        uint32_t Size() const { return m_size.load(std::memory_order_acquire); }
+
+        // The symbol with this id, or nullopt if it has not been handed out.
+        std::optional<Symbol> FromId(uint32_t id) const;
+
+    private:
+        SymbolTable();
+        ~SymbolTable();
+        SymbolTable(const SymbolTable&) = delete;
+        SymbolTable& operator=(const SymbolTable&) = delete;
+
+        struct Entry {
+            std::string text;
+            Symbol folded;
+        };
+
+        // Entries live in fixed-size chunks that never move, so Resolve needs no lock.
+        static constexpr uint32_t kChunkBits = 12;
+        static constexpr uint32_t kChunkSize = 1u << kChunkBits;
+        static constexpr uint32_t kMaxChunks = 4096;
+
+        const Entry& GetEntry(uint32_t id) const {
+            return m_chunks[id >> kChunkBits].load(std::memory_order_acquire)[id & (kChunkSize - 1)];
+        }
+
+        // Caller holds the lock exclusively.
+        Symbol InternLocked(std::string_view text);
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<std::string_view, uint32_t> m_index;    // Views into the entries
+        std::array<std::atomic<Entry*>, kMaxChunks> m_chunks{};
+        std::atomic<uint32_t> m_size = 0;
+    };
+
+    inline Symbol Symbol::Intern(std::string_view text) { return SymbolTable::GetSingleton().Intern(text); }
+    inline std::optional<Symbol> Symbol::Find(std::string_view text) { return SymbolTable::GetSingleton().Find(text); }
+    inline const std::string& Symbol::str() const { return SymbolTable::GetSingleton().Resolve(*this); }
+    inline Symbol Symbol::Folded() const { return SymbolTable::GetSingleton().Folded(*this); }
+
+    // Serializes as the resolved string
+    void to_json(nlohmann::json& j, const Symbol& symbol);
+
+    // Resolve a symbol set into sorted strings (for lists shown to the user)
+    std::vector<std::string> ToSortedStrings(const std::unordered_set<Symbol>& symbols);
+
+    // Intern a UI selection once, so filters compare ids per scene
+    std::vector<Symbol> InternAll(const std::unordered_set<std::string>& strings);
+
+    // An interned, immutable list of symbols. Equal lists have the same id; id 0
+    // is the empty list.
+    class SymbolList {
+    public:
+        constexpr SymbolList() = default;   // The empty list
+
+        // Thread-safe. Returns the existing list if the same symbols were interned before.
+        static SymbolList Intern(std::span<const Symbol> symbols);
+
+        std::span<const Symbol> view() const;
+        operator std::span<const Symbol>() const { return view(); }
+
+        const Symbol* begin() const { return view().data(); }
+        const Symbol* end() const { return begin() + size(); }
+        size_t size() const { return view().size(); }
+        bool empty() const { return m_id == 0; }
+        Symbol operator[](size_t index) const { return view()[index]; }
+
+        uint32_t Id() const { return m_id; }
+
+        friend bool operator==(SymbolList, SymbolList) = default;
+
+    private:
+        friend class SymbolListTable;
+        explicit constexpr SymbolList(uint32_t id) : m_id(id) {}
+
+        uint32_t m_id = 0;
+    };
+
+    class SymbolListTable {
+    public:
+        static SymbolListTable& GetSingleton() {
+            static SymbolListTable instance;
+            return instance;
+        }
+
+        SymbolList Intern(std::span<const Symbol> symbols);
+
+        // Lock-free, like SymbolTable::Resolve
+        std::span<const Symbol> Resolve(SymbolList list) const {
+            const Entry& entry = m_chunks[list.m_id >> kChunkBits].load(std::memory_order_acquire)[list.m_id & (kChunkSize - 1)];
+            return { entry.data, entry.size };
+        }
+
+    private:
+        SymbolListTable();
+        ~SymbolListTable();
+        SymbolListTable(const SymbolListTable&) = delete;
+        SymbolListTable& operator=(const SymbolListTable&) = delete;
+
+        struct Entry {
+            const Symbol* data = nullptr;       // Into m_blocks
+            uint32_t size = 0;
+        };
+
+        struct ListHash {
+            size_t operator()(std::span<const Symbol> symbols) const noexcept;
+        };
+        struct ListEqual {
+            bool operator()(std::span<const Symbol> a, std::span<const Symbol> b) const noexcept {
+                return std::equal(a.begin(), a.end(), b.begin(), b.end());
+            }
+        };
+
+        static constexpr uint32_t kChunkBits = 12;
+        static constexpr uint32_t kChunkSize = 1u << kChunkBits;
+        static constexpr uint32_t kMaxChunks = 4096;
+        static constexpr size_t kBlockSize = 4096;     // Symbols per storage block
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<std::span<const Symbol>, uint32_t, ListHash, ListEqual> m_index;
+        std::array<std::atomic<Entry*>, kMaxChunks> m_chunks{};
+        uint32_t m_size = 0;
+        std::vector<std::unique_ptr<Symbol[]>> m_blocks;
+        Symbol* m_blockCursor = nullptr;                // Next free symbol in the last block
+        size_t m_blockFree = 0;
+    };
+
+    inline SymbolList SymbolList::Intern(std::span<const Symbol> symbols) { return SymbolListTable::GetSingleton().Intern(symbols); }
+    inline std::span<const Symbol> SymbolList::view() const { return SymbolListTable::GetSingleton().Resolve(*this); }
+
+    // Serializes as an array of the resolved strings
+    void to_json(nlohmann::json& j, const SymbolList& list);
+}
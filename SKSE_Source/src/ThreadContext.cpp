@@ -0,0 +1,47 @@
+#include "ThreadContext.h"
+#include "ActorPropertiesDatabase.h"
+#include "FormUtils.h"
+#include "FurnitureDatabase.h"
+#include "OStimIntegration.h"
+
+namespace OStimNavigator {
+
+    namespace {
+        // OStim's schlongified faction (has a real penis): OStim.esp 0xE9C
+        bool IsSchlongified(RE::Actor* actor) {
+            static RE::TESFaction* s_faction = FormUtils::LookupForm<RE::TESFaction>(0xE9C, "OStim.esp");
+            if (!s_faction) return false;
+            return actor->IsInFaction(s_faction);
+        }
+    }
+
+    ThreadContext ThreadContext::Capture(uint32_t threadID) {
+        ThreadContext context;
+        context.threadID = threadID;
+
+        auto& propsDB = ActorPropertiesDatabase::GetSingleton();
+        for (RE::Actor* actor : OStimIntegration::GetSingleton().GetActorsFromThread(threadID)) {
+            ThreadActor& entry = context.actors.emplace_back();
+            entry.actor = actor;
+            if (!actor) continue;
+
+            if (auto* base = actor->GetActorBase()) {
+                auto sex = base->GetSex();
+                entry.isMale = sex == RE::SEXES::kMale;
+                entry.isFemale = sex == RE::SEXES::kFemale;
+            }
+            entry.schlongified = IsSchlongified(actor);
+            entry.requirements = propsDB.GetActorRequirementMask(actor);
+        }
+
+        // Furniture is read from actor 0's faction membership
+        if (const ThreadActor* first = context.Actor(0)) {
+            auto& furnitureDB = FurnitureDatabase::GetSingleton();
+            context.furnitureTypes = furnitureDB.GetFurnitureTypesFromActor(first->actor);
+            context.furnitureType = furnitureDB.GetFurnitureTypeFromActor(first->actor);
+        }
+
+        SKSE::log::debug("ThreadContext: Captured thread {} with {} actors", threadID, context.actors.size());
+        return context;
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "PCH.h"
+#include "ActionDatabase.h"
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * Thread context snapshots.
+ *
+ * Everything the filters and the description builder read from a thread's
+ * actors, resolved once per run: the actors themselves (one thread API call),
+ * their sex, whether they are schlongified, their ActorPropertiesDatabase
+ * requirement masks, and the furniture types actor 0 is in. Per-scene code reads
+ * the snapshot instead of going back to the game for every scene.
+ *
+ * Capture touches game forms, so call it on the game thread.
+ */
+
+namespace OStimNavigator {
+
+    struct ThreadActor {
+        RE::Actor* actor = nullptr;
+        bool isMale = false;
+        bool isFemale = false;
+        bool schlongified = false;                          // In OStim's schlongified faction
+        RequirementMask requirements;                       // From ActorPropertiesDatabase
+    };
+
+    struct ThreadContext {
+        // Snapshot the thread's actors and furniture
+        static ThreadContext Capture(uint32_t threadID);
+
+        // The actor in a slot, nullptr when the slot is out of range or unresolved
+        const ThreadActor* Actor(int slot) const {
+            if (slot < 0 || slot >= static_cast<int>(actors.size()) || !actors[slot].actor)
+                return nullptr;
+            return &actors[slot];
+        }
+
+        uint32_t ActorCount() const { return static_cast<uint32_t>(actors.size()); }
+
+        // An empty or unresolved slot meets every requirement; any other slot
+        // offers its actor's requirements
+        bool MeetsAllRequirements(int slot) const { return Actor(slot) == nullptr; }
+
+        uint32_t threadID = 0;
+        std::vector<ThreadActor> actors;                    // By thread slot
+        std::unordered_set<std::string> furnitureTypes;     // Actor 0's types and their supertypes
+        std::string furnitureType;                          // Actor 0's first furniture type, empty if none
+    };
+}
@@ -6,6 +6,7 @@
 #include "FurnitureDatabase.h"
 #include "SceneSimilarity.h"
 #include "SceneFilter.h"
+#include "Settings.h"
 #include "StringUtils.h"
 #include "SceneUIHelpers.h"
 #include <SKSEMenuFramework.h>
@@ -17,11 +18,12 @@ namespace OStimNavigator {
             // Window state
             static bool s_isShown = false;
             static uint32_t s_selectedThreadID = ~0u;
-            static SceneData* s_currentScene = nullptr;  // Current scene in the thread
+            static SceneHandle s_currentScene;  // Current scene in the thread
             static std::string s_lastSceneID = "";  // Track scene changes for similarity recalculation
             
             // Filter state
             static char s_searchBuffer[256] = "";
+            static bool s_fuzzySearch = true;
             static std::unordered_set<std::string> s_selectedModpacks;
             static std::unordered_set<std::string> s_selectedSceneTags;
             static std::unordered_set<std::string> s_selectedActorTags;
@@ -35,8 +37,10 @@ namespace OStimNavigator {
             static bool s_actionTagsAND = false;
             
             // Filtered results
-            static std::vector<SceneData*> s_filteredScenes;
-            static std::unordered_map<SceneData*, float> s_similarityScores;  // Cache for similarity scores
+            static std::vector<SceneHandle> s_filteredScenes;
+            static std::unordered_map<SceneHandle, float> s_similarityScores;  // Cache for similarity scores
+            static IncrementalSceneFilter s_sceneFilter;  // Refines the last result when one filter changes
+            static bool s_filterBenchmarked = false;      // BenchmarkSceneFilter runs once per session
             static int s_currentPage = 0;
             static int s_itemsPerPage = 50;
             
@@ -105,7 +109,7 @@ namespace OStimNavigator {
             // Forward declaration
             static void ApplyFilters(uint32_t threadID);
 
-            static void RenderSimilarityColumn(SceneData* scene) {
+            static void RenderSimilarityColumn(SceneHandle scene) {
                 if (s_currentScene && s_similarityScores.count(scene)) {
                     float similarity = s_similarityScores[scene];
                     ImGuiMCP::ImVec4 color = GetSimilarityColor(similarity);
@@ -180,8 +184,8 @@ namespace OStimNavigator {
                 ImGuiMCP::ImGui::TableSetColumnIndex(7);
                 std::unordered_set<std::string> uniqueActorTags;
                 for (const auto& actor : scene->actors) {
-                    for (const auto& tag : actor.tags) {
-                        uniqueActorTags.insert(tag);
+                    for (Symbol tag : actor.tags) {
+                        uniqueActorTags.insert(tag.str());
                     }
                 }
                 RenderPillCollection(uniqueActorTags, s_currentSceneActorTags,
@@ -194,7 +198,7 @@ namespace OStimNavigator {
                 // Scene Tags (as pills)
                 ImGuiMCP::ImGui::TableSetColumnIndex(8);
                 RenderPillCollection(scene->tags, s_currentSceneTags,
-                    [](const std::string& tag) -> const std::string& { return tag; },
+                    [](Symbol tag) -> const std::string& { return tag.str(); },
                     &s_selectedSceneTags, nullptr, false,
                     []() {
                         s_filtersNeedReapply = true;
@@ -210,6 +214,7 @@ namespace OStimNavigator {
                 // Build filter settings from current UI state
                 SceneFilterSettings settings;
                 settings.searchText = s_searchBuffer;
+                settings.fuzzySearch = s_fuzzySearch;
                 settings.selectedModpacks = s_selectedModpacks;
                 settings.selectedSceneTags = s_selectedSceneTags;
                 settings.selectedActorTags = s_selectedActorTags;
@@ -225,8 +230,13 @@ namespace OStimNavigator {
                 settings.hideNonRandom = s_hideNonRandom;
                 settings.hideIntroIdle = s_hideIntroIdle;
 
-                // Apply filters using SceneFilter module
-                auto result = SceneFilter::ApplyFilters(threadID, s_currentScene, settings);
+                // Apply filters using SceneFilter module, against one snapshot of the thread's actors
+                const ThreadContext thread = ThreadContext::Capture(threadID);
+                if (Settings::GetSingleton().benchmarkSceneFilter && !s_filterBenchmarked) {
+                    s_filterBenchmarked = true;
+                    SceneFilter::Benchmark(thread, s_currentScene, settings);
+                }
+                auto result = s_sceneFilter.Apply(thread, s_currentScene, settings);
                 
                 // Update local state with results
                 s_filteredScenes = std::move(result.filteredScenes);
@@ -306,7 +316,7 @@ namespace OStimNavigator {
                         uint32_t actorCount = iface->GetActorCount(threadID);
 
                         // Current Scene - collect data first
-                        s_currentScene = nullptr;  // Reset current scene
+                        SceneData* currentScene = nullptr;
                         s_currentSceneActions.clear();
                         s_currentSceneTags.clear();
                         s_currentSceneActorTags.clear();
@@ -316,25 +326,31 @@ namespace OStimNavigator {
                             const char* sceneID = iface->GetCurrentSceneID(threadID);
                             if (sceneID && sceneID[0] != '\0') {
                                 currentSceneID = sceneID;
-                                SceneData* sceneData = sceneDB.GetSceneByID(sceneID);
-                                s_currentScene = sceneData;  // Store current scene for similarity calculations
+                                // The ID is only looked up when the thread moves to another scene
+                                SceneData* sceneData = currentSceneID == s_lastSceneID ? sceneDB.Resolve(s_currentScene) : nullptr;
+                                if (!sceneData) {
+                                    sceneData = sceneDB.GetSceneByID(sceneID);
+                                }
+                                currentScene = sceneData;
                                 if (sceneData) {
                                     // Extract actions, scene tags, and actor tags from current scene
                                     for (const auto& action : sceneData->actions) {
-                                        s_currentSceneActions.insert(action.type);
+                                        s_currentSceneActions.insert(action.type.str());
                                     }
-                                    for (const auto& tag : sceneData->tags) {
-                                        s_currentSceneTags.insert(tag);
+                                    for (Symbol tag : sceneData->tags) {
+                                        s_currentSceneTags.insert(tag.str());
                                     }
                                     for (const auto& actor : sceneData->actors) {
-                                        for (const auto& tag : actor.tags) {
-                                            s_currentSceneActorTags.insert(tag);
+                                        for (Symbol tag : actor.tags) {
+                                            s_currentSceneActorTags.insert(tag.str());
                                         }
                                     }
                                 }
                             }
                         }
                         
+                        s_currentScene = currentScene ? currentScene->handle : SceneHandle{};  // Store current scene for similarity calculations
+
                         // Detect scene change and trigger similarity recalculation
                         if (currentSceneID != s_lastSceneID) {
                             SKSE::log::info("Scene changed from '{}' to '{}', triggering similarity recalculation", 
@@ -345,17 +361,17 @@ namespace OStimNavigator {
                         
                         // Determine thread type based on action tags
                         std::string threadType = "none";
-                        if (s_currentScene && actionDB.IsLoaded()) {
+                        if (currentScene && actionDB.IsLoaded()) {
                             bool hasSexual = false;
                             bool hasSensual = false;
                             
-                            for (const auto& action : s_currentScene->actions) {
-                                ActionData* actionData = actionDB.GetAction(action.type);
+                            for (const auto& action : currentScene->actions) {
+                                const ActionData* actionData = actionDB.GetAction(action.type);
                                 if (actionData) {
-                                    for (const auto& tag : actionData->tags) {
-                                        if (tag == "sexual") {
+                                    for (Symbol tag : actionData->tags) {
+                                        if (tag.view() == "sexual") {
                                             hasSexual = true;
-                                        } else if (tag == "romantic" || tag == "sensual") {
+                                        } else if (tag.view() == "romantic" || tag.view() == "sensual") {
                                             hasSensual = true;
                                         }
                                     }
@@ -373,29 +389,29 @@ namespace OStimNavigator {
                         ImGuiMCP::ImGui::Text("Selected Thread: Thread %u (%s)", threadID, threadType.c_str());
                         
                         // Gender Composition (on same line)
-                        if (s_currentScene && !s_currentScene->actors.empty()) {
+                        if (currentScene && !currentScene->actors.empty()) {
                             ImGuiMCP::ImGui::SameLine();
                             ImGuiMCP::ImGui::Text(" - ");
                             ImGuiMCP::ImGui::SameLine();
-                            RenderGenderComposition(s_currentScene->actors);
+                            RenderGenderComposition(currentScene->actors);
                         }
                         
                         // Current Scene
-                        if (s_currentScene && !s_currentScene->actions.empty()) {
+                        if (currentScene && !currentScene->actions.empty()) {
                             ImGuiMCP::ImGui::Text("Actions: ");
                             ImGuiMCP::ImGui::SameLine();
-                            RenderActionPillCollection(s_currentScene->actions, s_currentSceneActions, threadID, &s_selectedActions,
+                            RenderActionPillCollection(currentScene->actions, s_currentSceneActions, threadID, &s_selectedActions,
                                 []() {
                                     s_filtersNeedReapply = true;
                                 });
                         }
                         
                         // Scene Tags line with pills
-                        if (s_currentScene && !s_currentScene->tags.empty()) {
+                        if (currentScene && !currentScene->tags.empty()) {
                             ImGuiMCP::ImGui::Text("Scene Tags: ");
                             ImGuiMCP::ImGui::SameLine();
-                            RenderPillCollection(s_currentScene->tags, s_currentSceneTags,
-                                [](const std::string& tag) -> const std::string& { return tag; },
+                            RenderPillCollection(currentScene->tags, s_currentSceneTags,
+                                [](Symbol tag) -> const std::string& { return tag.str(); },
                                 &s_selectedSceneTags, nullptr, false,
                                 []() { 
                                     s_filtersNeedReapply = true; 
@@ -414,8 +430,10 @@ namespace OStimNavigator {
                                 
                                 // Get actor tags from current scene
                                 std::vector<std::string> actorTags;
-                                if (s_currentScene && i < s_currentScene->actors.size()) {
-                                    actorTags = s_currentScene->actors[i].tags;
+                                if (currentScene && i < currentScene->actors.size()) {
+                                    for (Symbol tag : currentScene->actors[i].tags) {
+                                        actorTags.push_back(tag.str());
+                                    }
                                 }
                                 
                                 // Display tags as pills
@@ -490,8 +508,16 @@ namespace OStimNavigator {
                         } else {
                             ImGuiMCP::ImGui::Text("Search:");
                         }
+                        ImGuiMCP::ImGui::SameLine();
+                        if (ImGuiMCP::ImGui::Checkbox("Fuzzy##fuzzy_search", &s_fuzzySearch)) {
+                            ApplyFilters(s_selectedThreadID);
+                        }
+                        if (ImGuiMCP::ImGui::IsItemHovered()) {
+                            ImGuiMCP::ImGui::SetTooltip("Tolerate typos, also match modpacks and tags, and rank by relevance");
+                        }
                         ImGuiMCP::ImGui::SetNextItemWidth(-10.0f);
-                        if (ImGuiMCP::ImGui::InputTextWithHint("##search", "Scene name or ID...", s_searchBuffer, sizeof(s_searchBuffer))) {
+                        const char* searchHint = s_fuzzySearch ? "Scene name, ID, modpack or tag..." : "Scene name or ID...";
+                        if (ImGuiMCP::ImGui::InputTextWithHint("##search", searchHint, s_searchBuffer, sizeof(s_searchBuffer))) {
                             ApplyFilters(s_selectedThreadID);
                         }
                         
@@ -511,12 +537,12 @@ namespace OStimNavigator {
                         ImGuiMCP::ImGui::SetNextItemWidth(-10.0f);
                         ImGuiMCP::ImGui::PushStyleColor(ImGuiMCP::ImGuiCol_PopupBg, ImGuiMCP::ImVec4(0.12f, 0.12f, 0.14f, 1.0f));
                         if (ImGuiMCP::ImGui::BeginCombo("##modpack_combo", modpackPreview.c_str())) {
-                            if (sceneDB.IsLoaded()) {
+                            if (sceneDB.IsReady()) {
                                 std::unordered_set<std::string> allModpacks;
                                 auto allScenes = sceneDB.GetAllScenes();
                                 for (auto* scene : allScenes) {
                                     if (scene && !scene->modpack.empty()) {
-                                        allModpacks.insert(scene->modpack);
+                                        allModpacks.insert(scene->modpack.str());
                                     }
                                 }
                                 
@@ -547,7 +573,7 @@ namespace OStimNavigator {
                         ImGuiMCP::ImGui::Spacing();
                         
                         // Scene Tags, Actor Tags, Actions, and Action Tags filters
-                        if (sceneDB.IsLoaded()) {
+                        if (sceneDB.IsReady()) {
                             static char tagSearchBuffer[128] = "";
                             static char actorTagSearchBuffer[128] = "";
                             static char actionSearchBuffer[128] = "";
@@ -703,13 +729,18 @@ namespace OStimNavigator {
                                         const auto& spec = sortSpecs->Specs[0];
                                         
                                         std::sort(s_filteredScenes.begin(), s_filteredScenes.end(),
-                                            [&spec](const SceneData* a, const SceneData* b) {
+                                            [&spec, &sceneDB](SceneHandle handleA, SceneHandle handleB) {
+                                                const SceneData* a = sceneDB.Resolve(handleA);
+                                                const SceneData* b = sceneDB.Resolve(handleB);
+                                                if (!a || !b) {
+                                                    return a && !b;  // Stale handles sink to the end
+                                                }
                                                 int delta = 0;
                                                 
                                                 switch (spec.ColumnIndex) {
                                                     case 0: {  // Similarity
-                                                        auto itA = s_similarityScores.find(const_cast<SceneData*>(a));
-                                                        auto itB = s_similarityScores.find(const_cast<SceneData*>(b));
+                                                        auto itA = s_similarityScores.find(handleA);
+                                                        auto itB = s_similarityScores.find(handleB);
                                                         float simA = (itA != s_similarityScores.end()) ? itA->second : 0.0f;
                                                         float simB = (itB != s_similarityScores.end()) ? itB->second : 0.0f;
                                                         delta = (simA < simB) ? -1 : (simA > simB) ? 1 : 0;
@@ -728,7 +759,7 @@ namespace OStimNavigator {
                                                         delta = 0;
                                                         break;
                                                     case 5:  // Modpack
-                                                        delta = a->modpack.compare(b->modpack);
+                                                        delta = a->modpack.str().compare(b->modpack.str());
                                                         break;
                                                     case 6:  // Actions (compare count)
                                                         delta = (int)a->actions.size() - (int)b->actions.size();
@@ -750,14 +781,14 @@ namespace OStimNavigator {
                             int endIdx = std::min(startIdx + s_itemsPerPage, (int)s_filteredScenes.size());
                             
                             for (int i = startIdx; i < endIdx; ++i) {
-                                SceneData* scene = s_filteredScenes[i];
+                                SceneData* scene = sceneDB.Resolve(s_filteredScenes[i]);
                                 if (!scene) continue;
                                 
                                 ImGuiMCP::ImGui::TableNextRow();
                                 
                                 // Similarity Score
                                 ImGuiMCP::ImGui::TableSetColumnIndex(0);
-                                RenderSimilarityColumn(scene);
+                                RenderSimilarityColumn(s_filteredScenes[i]);
                                 
                                 RenderSceneRow(scene, i, threadID);
                             }
@@ -2,6 +2,7 @@
 #include "ThreadExplorer.h"
 #include "OStimIntegration.h"
 #include "OStimNetIntegration.h"
+#include "SceneDatabase.h"
 #include <SKSEMenuFramework.h>
 
 namespace OStimNavigator {
@@ -95,6 +96,18 @@ namespace OStimNavigator {
                     return;
                 }
 
+                switch (SceneDatabase::GetSingleton().GetLoadState()) {
+                    case SceneDatabase::LoadState::Ready:
+                        break;
+                    case SceneDatabase::LoadState::Failed:
+                        ImGuiMCP::ImGui::TextColored(ImGuiMCP::ImVec4(1.0f, 0.0f, 0.0f, 1.0f),
+                            "Scene catalog failed to load, see OstimNavigator.log");
+                        return;
+                    default:
+                        ImGuiMCP::ImGui::TextColored(ImGuiMCP::ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Scene catalog is loading...");
+                        return;
+                }
+
                 auto* iface = ostim.GetThreadInterface();
                 if (!iface) {
                     SKSE::log::error("UI::ActiveThreads::Render: ThreadInterface not available");
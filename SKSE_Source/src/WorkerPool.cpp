@@ -0,0 +1,121 @@
+#include "WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace OStimNavigator {
+
+    struct WorkerPool::Job {
+        const std::function<void(size_t)>* task = nullptr;
+        size_t count = 0;
+        size_t workers = 0;                     // Pool threads allowed to join
+        size_t joined = 0;                      // Guarded by m_mutex
+        size_t active = 0;                      // Pool threads still working, guarded by m_mutex
+        std::atomic<size_t> next = 0;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    WorkerPool::~WorkerPool() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+
+    size_t WorkerPool::MaxThreads() const {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    void WorkerPool::Start(size_t workerCount) {
+        const size_t started = m_workers.size();
+        m_workers.reserve(workerCount);
+        while (m_workers.size() < workerCount) {
+            m_workers.emplace_back([this]() { WorkerLoop(); });
+        }
+        SKSE::log::debug("WorkerPool: started {} worker thread(s), {} in total", workerCount - started, workerCount);
+    }
+
+    void WorkerPool::Work(Job& job) {
+        for (size_t index = job.next++; index < job.count; index = job.next++) {
+            try {
+                (*job.task)(index);
+            } catch (...) {
+                std::lock_guard lock(job.errorMutex);
+                if (!job.error) {
+                    job.error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    void WorkerPool::WorkerLoop() {
+        uint64_t seen = 0;
+        for (;;) {
+            Job* job = nullptr;
+            {
+                std::unique_lock lock(m_mutex);
+                m_wake.wait(lock, [&]() { return m_stop || m_generation != seen; });
+                if (m_stop) return;
+                seen = m_generation;
+                if (!m_job || m_job->joined >= m_job->workers) continue;
+                job = m_job;
+                ++job->joined;
+                ++job->active;
+            }
+
+            Work(*job);
+
+            {
+                std::lock_guard lock(m_mutex);
+                --job->active;
+            }
+            m_finished.notify_all();
+        }
+    }
+
+    void WorkerPool::ParallelFor(size_t count, size_t threads, const std::function<void(size_t)>& task) {
+        threads = std::min(threads, count);
+        if (threads <= 1) {
+            for (size_t i = 0; i < count; ++i) {
+                task(i);
+            }
+            return;
+        }
+
+        std::lock_guard run(m_runMutex);
+        if (m_workers.size() < threads - 1) {
+            Start(threads - 1);
+        }
+
+        Job job;
+        job.task = &task;
+        job.count = count;
+        job.workers = threads - 1;
+        {
+            std::lock_guard lock(m_mutex);
+            m_job = &job;
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        Work(job);
+
+        // Every part has been handed out; wait for the workers still on one
+        {
+            std::unique_lock lock(m_mutex);
+            m_job = nullptr;
+            m_finished.wait(lock, [&]() { return job.active == 0; });
+        }
+
+        if (job.error) {
+            std::rethrow_exception(job.error);
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "PCH.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OStimNavigator {
+
+    // A small pool of long-lived worker threads for work that is split into
+    // independent parts, such as filtering chunks of the scene catalog. The
+    // threads are started on first use and sleep between jobs, so a filter run
+    // does not pay for creating threads. Tasks must not touch game forms.
+    class WorkerPool {
+    public:
+        static WorkerPool& GetSingleton() {
+            static WorkerPool instance;
+            return instance;
+        }
+
+        // One thread per hardware thread: the default for a job
+        size_t MaxThreads() const;
+
+        // Run task(0) .. task(count - 1) on up to threads threads, the caller's
+        // included, and return once all of them have finished. The pool grows
+        // to the largest thread count asked for. Parts are handed
+        // out in order but may finish in any order. The first exception a task
+        // throws is rethrown here after the others have finished.
+        void ParallelFor(size_t count, size_t threads, const std::function<void(size_t)>& task);
+
+    private:
+        struct Job;
+
+        WorkerPool() = default;
+        ~WorkerPool();
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        void Start(size_t workerCount);
+        void WorkerLoop();
+        static void Work(Job& job);
+
+        std::mutex m_runMutex;                  // One job at a time
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_finished;
+        Job* m_job = nullptr;
+        uint64_t m_generation = 0;
+        bool m_stop = false;
+        std::vector<std::thread> m_workers;
+    };
+}